@@ -0,0 +1,111 @@
+#ifndef CALENDAR_TIME_H
+#define CALENDAR_TIME_H
+
+#include <stdint.h>
+#include "RTClib.h"
+
+// The fields of the time shown, counted on a second at a time instead of
+// being worked out from a unix time on every loop pass. Only a tick into a
+// new day looks at the calendar (month lengths, leap years); anything but
+// the next second sets every field from the unix time again, as after
+// setting the clock or a step. Each update says which fields changed, so
+// the face can tell a new minute or hour from a new second.
+class CalendarTime
+{
+public:
+    enum Change : uint8_t
+    {
+        SECOND = 1,
+        MINUTE = 2,
+        HOUR = 4,
+        DAY = 8,
+        MONTH = 16,
+        YEAR = 32,
+        ALL = 63
+    };
+
+private:
+    uint32_t seconds = 0; // Unix time
+    uint16_t y = 2000;
+    uint8_t mo = 1, d = 1, h = 0, mi = 0, s = 0;
+    uint8_t dow = 6; // 0 is Sunday
+    uint8_t changed = 0;
+
+    static uint8_t daysIn(uint8_t month, uint16_t year)
+    {
+        static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+        return days[month - 1] + (month == 2 && leap);
+    }
+
+    void tick()
+    {
+        seconds++;
+        changed = SECOND;
+        if (++s < 60)
+            return;
+        s = 0;
+        changed |= MINUTE;
+        if (++mi < 60)
+            return;
+        mi = 0;
+        changed |= HOUR;
+        if (++h < 24)
+            return;
+        h = 0;
+        changed |= DAY;
+        dow = dow == 6 ? 0 : dow + 1;
+        if (++d <= daysIn(mo, y))
+            return;
+        d = 1;
+        changed |= MONTH;
+        if (++mo <= 12)
+            return;
+        mo = 1;
+        y++;
+        changed |= YEAR;
+    }
+
+public:
+    CalendarTime() { set(DateTime()); }
+
+    void set(const DateTime &time)
+    {
+        seconds = time.unixtime();
+        y = time.year();
+        mo = time.month();
+        d = time.day();
+        h = time.hour();
+        mi = time.minute();
+        s = time.second();
+        dow = time.dayOfTheWeek();
+        changed = ALL;
+    }
+
+    // Brings the fields to unix second t; returns the Change bits of the
+    // fields that moved, 0 when t is the second already held
+    uint8_t advanceTo(uint32_t t)
+    {
+        if (t == seconds)
+            changed = 0;
+        else if (t == seconds + 1)
+            tick();
+        else
+            set(DateTime(t));
+        return changed;
+    }
+
+    // Change bits of the latest set() or advanceTo()
+    uint8_t changes() const { return changed; }
+
+    uint16_t year() const { return y; }
+    uint8_t month() const { return mo; }
+    uint8_t day() const { return d; }
+    uint8_t hour() const { return h; }
+    uint8_t minute() const { return mi; }
+    uint8_t second() const { return s; }
+    uint8_t dayOfTheWeek() const { return dow; }
+    uint32_t unixtime() const { return seconds; }
+};
+
+#endif // CALENDAR_TIME_H
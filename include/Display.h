@@ -2,40 +2,119 @@
 #define CLOCK_SETTINGS_FACE_H
 
 #include "M5Dial.h"
-#include <TFT_eSPI.h>
-#include "fonts/Noto.h"
-#include "fonts/smallFont.h"
-#include "fonts/middleFont.h"
-#include "fonts/bigFont.h"
-#include "fonts/secFont.h"
+#include "fonts/NotoPacked.h"
+#include "fonts/middleFontPacked.h"
+#include "fonts/bigFontPacked.h"
+#include "fonts/secFontPacked.h"
 #include "Preferences.h"
 #include "RTClib.h"
+#include "gfx/Canvas.h"
+#include "gfx/DirtyRegion.h"
+#include "gfx/FontRegistry.h"
+#include "gfx/PixelLayer.h"
+#include "gfx/PolarTable.h"
+#include "gfx/RenderTarget.h"
+#include "CalendarTime.h"
+#include "FrameHistogram.h"
+#include "FrameProfiler.h"
+#include "SettingsStore.h"
+#include "SoftClock.h"
+#include "TimeText.h"
+
+#ifndef CLOCK_SMOOTH_SWEEP
+#define CLOCK_SMOOTH_SWEEP 0 // 1 sweeps the bezel continuously instead of once a second
+#endif
+
+#ifndef TICK_CACHE_BUDGET
+#define TICK_CACHE_BUDGET 12288 // Bytes for pre-rasterized major tick configurations
+#endif
 
 class Display
 {
 private:
-    M5Canvas &img;
-    TFT_eSPI &tft;
-    TFT_eSprite &sprite;
-    RTC_DS1307 &rtc; // RTC object
-    Preferences &preferences; // Preferences object for storing settings
+    Canvas canvas;
+    FontRegistry<4> fonts; // Every font the UI uses, parsed once in begin()
+    uint32_t residentAllocations = 0; // Font allocations made by begin()
+    uint32_t swapsAtLastFrame = 0;    // byteSwaps() when the previous frame was pushed
+    GlyphAtlas secondsDigits, timeDigits; // secFont and bigFont in their face colours
+    SoftClock softClock; // The time shown, kept by the RTC without reading it every loop
+    SettingsStore settings; // In the RTC's RAM, with NVS as backup
 
     // Clock-related variables
     static constexpr int r = 116;
     static constexpr int sx = 120;
     static constexpr int sy = 120;
-    float x[360], y[360], px[360], py[360], lx[360], ly[360];
     unsigned short grays[12];
-    int start[12], startP[60];
-    int angle = 0;
+
+    // Colours for an indexed framebuffer (INDEXED_FRAMEBUFFER). Everything is
+    // drawn over black, so each colour comes with darker steps towards black
+    // for its anti-aliased edges.
+    uint16_t facePalette[16], menuPalette[16];
+
+    // Bezel angles are in 1/8 degree steps: fine enough for the sweep, and
+    // whole seconds (6 degrees) land exactly on the grid
+    static constexpr int stepsPerDegree = 8;
+    static constexpr int secondStep = 6 * stepsPerDegree;
+    static constexpr int hourStep = 30 * stepsPerDegree;
+    typedef PolarTable<r - 20, sx, sy, stepsPerDegree> LabelRing;
+    typedef PolarTable<r, sx, sy, stepsPerDegree> OuterRing;
+    typedef PolarTable<r - 6, sx, sy, stepsPerDegree> InnerRing;
+
+    // Damage tracking for the clock face. Each moving element remembers the
+    // box it covered and the state it was drawn with; only boxes whose state
+    // changed are cleared, redrawn and pushed.
+    struct FaceElement
+    {
+        Rect box;
+        int key = -1;
+    };
+    FaceElement secondsText, timeText, ticks[12], labels[12], dots[60];
+    Rect secondsBox, timeBox, brandBox, starsBox, pointerBox, dotBoxes[60];
+    int labelWidth[12];
+    int notoHeight = 0;
+    DirtyRegion<64> damage{240, 240};
+    PixelLayer<480, 1200> dotLayer;
+    bool faceValid = false;
+
+    // The 12 major ticks can only be in 5 configurations (angle % 30 in 6
+    // degree steps). As many as fit in TICK_CACHE_BUDGET are rasterized at
+    // begin(); the rest are drawn directly.
+    typedef PixelLayer<160, 640> TickLayer;
+    static constexpr int tickPhases = 5;
+    static constexpr int tickCacheSlots = TICK_CACHE_BUDGET / sizeof(TickLayer) < tickPhases ? TICK_CACHE_BUDGET / sizeof(TickLayer) : tickPhases;
+    TickLayer tickLayers[tickCacheSlots > 0 ? tickCacheSlots : 1];
+
+    struct FrameStats
+    {
+        uint32_t pushedPixels = 0;    // Pixels sent to the panel by the latest frame
+        uint32_t frameMicros = 0;     // Render and push time of the latest clock frame
+        uint32_t tickCacheHits = 0;   // Clock frames that composited cached ticks
+        uint32_t tickCacheMisses = 0; // Clock frames that drew the ticks directly
+        uint32_t fontAllocations = 0; // Glyph tables allocated since begin() returned
+        uint32_t textMicros = 0;      // Time the latest clock frame spent on the time and seconds text
+        uint32_t rampBuilds = 0;      // Blend ramps built so far; flat once every colour has been drawn
+        uint32_t byteSwaps = 0;       // Pixels byte swapped on the CPU by the latest frame, with SWAP_STATS
+    } stats;
+    FrameHistogram frameTimes;
+#if FRAME_PROFILER
+    FrameProfiler profiler;
+#endif
+
+    // Smooth sweep pacing, see drawSweepFrame()
+    bool smoothSweep = CLOCK_SMOOTH_SWEEP;
+    const uint32_t sweepIntervals[3] = {16667, 33333, 50000}; // 60, 30 and 20 fps
+    int sweepRate = 0;
+    uint32_t sweepCost = 0; // Running average of sweep frame times
+    unsigned long secondEdge = 0;
+    unsigned long lastSweepFrame = 0;
 
     // Settings-related variables
     int highlighedOption = 0;
-    uint8_t brightness = preferences.getUInt("brightness", 65); // Default brightness value
+    uint8_t brightness = Settings().brightness;
     static constexpr int totalOptions = 3;
     const char *options[totalOptions] = {"Brightness", "Manual Time Set", "Back"};
 
-    DateTime now = rtc.now();
+    CalendarTime now; // Counted on from softClock, a second at a time
 
 
     // Mode management
@@ -47,83 +126,352 @@ private:
         SET_TIME
     } currentMode = CLOCK;
 
-    void initializeCoordinates()
+    void initializeGrayscale()
+    {
+        int co = 210;
+        for (int i = 0; i < 12; i++)
+        {
+            grays[i] = Canvas::color565(co, co, co);
+            co -= 20;
+        }
+    }
+
+    void initializePalettes()
     {
-        constexpr double rad = M_PI / 180.0;
-        int b = 0, b2 = 0;
+        int n = 0;
+        facePalette[n++] = TFT_BLACK;
+        for (int i = 0; i <= 10; i++) // 210 down to 10
+            facePalette[n++] = grays[i];
+        for (int a = 255; a > 0; a -= 64) // Brand text and pointer
+            facePalette[n++] = Canvas::blend(a, 0xA380, TFT_BLACK);
+
+        n = 0;
+        menuPalette[n++] = TFT_BLACK;
+        for (int a = 255; a > 0; a -= 51)
+            menuPalette[n++] = Canvas::blend(a, TFT_WHITE, TFT_BLACK);
+        for (int a = 255; a > 0; a -= 64)
+            menuPalette[n++] = Canvas::blend(a, TFT_ORANGE, TFT_BLACK);
+        for (int a = 255; a > 0; a -= 96)
+            menuPalette[n++] = Canvas::blend(a, TFT_DARKGREY, TFT_BLACK);
+        for (int a = 255; a > 0; a -= 128)
+            menuPalette[n++] = Canvas::blend(a, TFT_RED, TFT_BLACK);
+    }
 
-        for (int i = 0; i < 360; i++)
+    static int labelNumber(int i)
+    {
+        return (i <= 9) ? (45 - i * 5) : (55 - (i - 10) * 5);
+    }
+
+    int widestDigit()
+    {
+        int widest = 0;
+        char digit[2] = {'0', 0};
+        for (; digit[0] <= '9'; digit[0]++)
+            widest = max(widest, (int)canvas.textWidth(digit));
+        return widest;
+    }
+
+    // Measures the boxes that do not depend on the time. Text boxes are sized
+    // for the widest digits so they never have to be measured per frame.
+    void initializeFaceLayout()
+    {
+        canvas.setFont(fonts.find(secFontPacked));
+        secondsBox = Rect::centred(sx, sy - 42, 2 * widestDigit(), canvas.fontHeight(), 2);
+
+        canvas.setFont(fonts.find(bigFontPacked));
+        timeBox = Rect::centred(sx, sy + 32, 4 * widestDigit() + canvas.textWidth(":"), canvas.fontHeight(), 2);
+
+        canvas.setFont(fonts.find(NotoPacked));
+        notoHeight = canvas.fontHeight();
+        brandBox = Rect::centred(120, 190, canvas.textWidth("APLISENS"), notoHeight, 2);
+        starsBox = Rect::centred(120, 114, canvas.textWidth("***"), notoHeight, 2);
+        for (int i = 0; i < 12; i++)
+            labelWidth[i] = canvas.textWidth(TimeText::number(labelNumber(i)).c_str());
+
+        // The dot ring moves in 6 degree steps, so the set of dot positions never changes
+        for (int i = 0; i < 60; i++)
         {
-            x[i] = ((r - 20) * cos(rad * i)) + sx;
-            y[i] = ((r - 20) * sin(rad * i)) + sy;
-            px[i] = (r * cos(rad * i)) + sx;
-            py[i] = (r * sin(rad * i)) + sy;
-            lx[i] = ((r - 6) * cos(rad * i)) + sx;
-            ly[i] = ((r - 6) * sin(rad * i)) + sy;
+            FixedPoint dot = OuterRing::at(i * secondStep);
+            dotBoxes[i] = Rect::around(dot.pixelX(), dot.pixelY(), dot.pixelX(), dot.pixelY(), 3);
+        }
+        pointerBox = Rect::around(sx - 1, sy - 82, sx - 1, sy - 70, 7);
+    }
 
-            if (i % 30 == 0)
-                start[b++] = i;
-            if (i % 6 == 0)
-                startP[b2++] = i;
+    // Rasterizes the minute-dot ring once. The ring only ever turns in 6 degree
+    // steps, so the same pixels are valid for every second of the minute.
+    void initializeDotLayer()
+    {
+        canvas.fillScreen(TFT_BLACK);
+        for (int i = 0; i < 60; i++)
+        {
+            FixedPoint dot = OuterRing::at(i * secondStep);
+            canvas.fillSmoothCircle(dot.toX(), dot.toY(), 1, grays[4], TFT_BLACK);
         }
+
+        dotLayer.clear();
+        uint16_t black = toPanel565(TFT_BLACK);
+        for (int i = 0; i < 60; i++)
+            if (!dotLayer.capture(canvas.surface(), dotBoxes[i], black, canvas.glass()))
+                break; // Keep drawing the dots directly
     }
 
-    void initializeGrayscale()
+    void initializeTickCache()
     {
-        int co = 210;
-        for (int i = 0; i < 12; i++)
+        uint16_t black = toPanel565(TFT_BLACK);
+        for (int phase = 0; phase < tickCacheSlots; phase++)
         {
-            grays[i] = tft.color565(co, co, co);
-            co -= 20;
+            canvas.fillScreen(TFT_BLACK);
+            for (int i = 0; i < 12; i++)
+                drawTick(spokeAt(i * hourStep + phase * secondStep));
+
+            tickLayers[phase].clear();
+            for (int i = 0; i < 12; i++)
+            {
+                if (!tickLayers[phase].capture(canvas.surface(), spokeAt(i * hourStep + phase * secondStep).tickBox(), black, canvas.glass()))
+                    break; // This phase falls back to direct drawing
+            }
         }
     }
 
-    void drawClockFace()
+    // The clock's digits are always the same two colours on black, so they
+    // are blended once here and copied from then on
+    void initializeDigitAtlases()
+    {
+        if (const VlwFont *font = fonts.find(secFontPacked))
+            secondsDigits.build(*font, "0123456789", grays[1], TFT_BLACK);
+        if (const VlwFont *font = fonts.find(bigFontPacked))
+            timeDigits.build(*font, "0123456789:", grays[0], TFT_BLACK);
+    }
+
+    void selectFont(const uint8_t *vlw)
+    {
+        PROFILE_STAGE(profiler, FONT);
+        canvas.setFont(fonts.find(vlw));
+    }
+
+    // Draws from the atlas when it was built, blending from the font otherwise
+    void drawDigits(const GlyphAtlas &atlas, const uint8_t *vlw, uint16_t color, const Rect &box, const char *text, int x, int y)
+    {
+        if (!atlas.ready())
+        {
+            selectFont(vlw);
+            canvas.setTextColor(color, TFT_BLACK);
+        }
+        PROFILE_STAGE(profiler, TEXT);
+        drawDamaged(box, [&]
+                    { atlas.ready() ? canvas.drawString(atlas, text, x, y) : canvas.drawString(text, x, y); });
+    }
+
+    void clearScreen()
+    {
+        PROFILE_STAGE(profiler, CLEAR);
+        canvas.setPalette(menuPalette, 16);
+        canvas.fillScreen(TFT_BLACK);
+    }
+
+    void track(FaceElement &element, const Rect &box, int key)
     {
-        now = rtc.now();
-        angle = now.second() * 6;
+        if (element.key == key && element.box == box)
+            return;
+        damage.add(element.box);
+        damage.add(box);
+        element.box = box;
+        element.key = key;
+    }
 
-        if (angle >= 360)
-            angle = 0;
+    // Runs draw once for every damaged rectangle that overlaps box, clipped to it
+    template <typename F>
+    void drawDamaged(const Rect &box, F draw)
+    {
+        for (const Rect &d : damage)
+        {
+            if (!d.intersects(box))
+                continue;
+            canvas.setClip(d);
+            draw();
+        }
+        canvas.resetClip();
+    }
 
-        sprite.fillSprite(TFT_BLACK);
-        sprite.setTextColor(TFT_WHITE, grays[8]);
+    void pushDamage()
+    {
+        {
+            PROFILE_STAGE(profiler, PUSH);
+            stats.pushedPixels = 0;
+            for (const Rect &d : damage)
+                stats.pushedPixels += canvas.present(d);
+        }
+        stats.fontAllocations = VlwFont::allocations() - residentAllocations;
+        stats.rampBuilds = canvas.rampBuilds();
+        stats.byteSwaps = byteSwaps() - swapsAtLastFrame;
+        swapsAtLastFrame = byteSwaps();
+        PROFILE_END_FRAME(profiler);
+    }
 
-        sprite.loadFont(secFont);
-        sprite.setTextColor(grays[1], TFT_BLACK);
-        sprite.drawString(now.second() < 10 ? "0" + String(now.second()) : String(now.second()), sx, sy - 42);
-        sprite.unloadFont();
+    void pushFullFrame()
+    {
+        {
+            PROFILE_STAGE(profiler, PUSH);
+            stats.pushedPixels = canvas.present(Rect(0, 0, 240, 240));
+        }
+        stats.fontAllocations = VlwFont::allocations() - residentAllocations;
+        stats.rampBuilds = canvas.rampBuilds();
+        stats.byteSwaps = byteSwaps() - swapsAtLastFrame;
+        swapsAtLastFrame = byteSwaps();
+        PROFILE_END_FRAME(profiler);
+        faceValid = false; // The sprite no longer holds the clock face
+    }
 
-        sprite.loadFont(bigFont);
-        sprite.setTextColor(grays[0], TFT_BLACK);
+    // Label position and the outer and inner tick ends of the spoke at step
+    struct Spoke
+    {
+        FixedPoint label, outer, inner;
 
-        String m = now.minute() < 10 ? "0" + String(now.minute()) : String(now.minute());
-        String h = now.hour() < 10 ? "0" + String(now.hour()) : String(now.hour());
-        sprite.drawString(h + ":" + m, sx, sy + 32);
-        sprite.unloadFont();
+        Rect tickBox() const { return Rect::around(outer.pixelX(), outer.pixelY(), inner.pixelX(), inner.pixelY(), 4); }
+    };
 
-        sprite.loadFont(Noto);
-        sprite.setTextColor(0xA380, TFT_BLACK);
-        sprite.drawString("APLISENS", 120, 190);
-        sprite.drawString("***", 120, 114);
-        sprite.setTextColor(grays[3], TFT_BLACK);
+    static Spoke spokeAt(int step) { return {LabelRing::at(step), OuterRing::at(step), InnerRing::at(step)}; }
 
-        for (int i = 0; i < 60; i++)
+    void drawTick(const Spoke &s)
+    {
+        canvas.drawWedgeLine(s.outer.toX(), s.outer.toY(), s.inner.toX(), s.inner.toY(), 2, 2, grays[3], TFT_BLACK);
+    }
+
+    // Renders the face with the bezel turned by bezel steps of 1/8 degree.
+    // On whole seconds the cached dot ring and ticks apply.
+    void drawClockFace(int bezel)
+    {
+        unsigned long frameStart = micros();
+        bezel = OuterRing::wrap(bezel);
+        bool onGrid = bezel % secondStep == 0;
+
+        damage.clear();
+        if (!faceValid)
         {
-            int idx = (startP[i] + angle) % 360;
-            sprite.fillSmoothCircle(px[idx], py[idx], 1, grays[4], TFT_BLACK);
+            canvas.setPalette(facePalette, 16);
+            damage.invalidateAll();
         }
 
+        track(secondsText, secondsBox, now.second());
+        track(timeText, timeBox, now.hour() * 60 + now.minute());
+
+        Spoke spokes[12];
         for (int i = 0; i < 12; i++)
         {
-            int idx = (start[i] + angle) % 360;
-            int number = (i <= 9) ? (45 - i * 5) : (55 - (i - 10) * 5);
-            sprite.drawNumber(number, x[idx], y[idx]);
-            sprite.drawWedgeLine(px[idx], py[idx], lx[idx], ly[idx], 2, 2, grays[3], TFT_BLACK);
+            int a = OuterRing::wrap(i * hourStep + bezel);
+            const Spoke &s = spokes[i] = spokeAt(a);
+            track(ticks[i], s.tickBox(), a);
+            track(labels[i], Rect::centred(s.label.pixelX(), s.label.pixelY(), labelWidth[i], notoHeight, 2), i);
+        }
+
+        // On whole seconds the ring looks the same, so it only moves in between
+        FixedPoint dotAt[60];
+        for (int i = 0; i < 60; i++)
+        {
+            int a = onGrid ? i * secondStep : OuterRing::wrap(i * secondStep + bezel);
+            const FixedPoint &p = dotAt[i] = OuterRing::at(a);
+            track(dots[i], Rect::around(p.pixelX(), p.pixelY(), p.pixelX(), p.pixelY(), 3), a);
         }
+        faceValid = true;
 
-        sprite.drawWedgeLine(sx - 1, sy - 82, sx - 1, sy - 70, 1, 5, 0xA380, TFT_BLACK);
-        M5Dial.Display.pushImage(0, 0, 240, 240, (uint16_t *)sprite.getPointer());
+        {
+            PROFILE_STAGE(profiler, CLEAR);
+            for (const Rect &d : damage)
+                canvas.fillRect(d.x, d.y, d.w, d.h, TFT_BLACK);
+        }
+
+        unsigned long textStart = micros();
+        if (damage.intersects(secondsBox))
+        {
+            TimeText s = TimeText::twoDigits(now.second());
+            drawDigits(secondsDigits, secFontPacked, grays[1], secondsBox, s.c_str(), sx, sy - 42);
+        }
+
+        if (damage.intersects(timeBox))
+        {
+            TimeText hm = TimeText::hourMinute(now.hour(), now.minute());
+            drawDigits(timeDigits, bigFontPacked, grays[0], timeBox, hm.c_str(), sx, sy + 32);
+        }
+        stats.textMicros = micros() - textStart;
+
+        selectFont(NotoPacked);
+        {
+            PROFILE_STAGE(profiler, TEXT);
+            canvas.setTextColor(0xA380, TFT_BLACK);
+            drawDamaged(brandBox, [&]
+                        { canvas.drawString("APLISENS", 120, 190); });
+            drawDamaged(starsBox, [&]
+                        { canvas.drawString("***", 120, 114); });
+        }
+
+        {
+            PROFILE_STAGE(profiler, DOTS);
+            if (onGrid && dotLayer.ready())
+            {
+                for (const Rect &d : damage)
+                    dotLayer.draw(canvas.surface(), d);
+            }
+            else
+            {
+                for (int i = 0; i < 60; i++)
+                    drawDamaged(dots[i].box, [&]
+                                { canvas.fillSmoothCircle(dotAt[i].toX(), dotAt[i].toY(), 1, grays[4], TFT_BLACK); });
+            }
+        }
+
+        {
+            PROFILE_STAGE(profiler, TEXT);
+            canvas.setTextColor(grays[3], TFT_BLACK);
+            for (int i = 0; i < 12; i++)
+                drawDamaged(labels[i].box, [&]
+                            { canvas.drawNumber(labelNumber(i), spokes[i].label.pixelX(), spokes[i].label.pixelY()); });
+        }
+
+        // Labels and ticks never overlap, so the ticks can all go after the labels
+        {
+            PROFILE_STAGE(profiler, TICKS);
+            int phase = bezel % hourStep / secondStep;
+            if (onGrid && phase < tickCacheSlots && tickLayers[phase].ready())
+            {
+                stats.tickCacheHits++;
+                for (const Rect &d : damage)
+                    tickLayers[phase].draw(canvas.surface(), d);
+            }
+            else
+            {
+                stats.tickCacheMisses++;
+                for (int i = 0; i < 12; i++)
+                    drawDamaged(ticks[i].box, [&]
+                                { drawTick(spokes[i]); });
+            }
+        }
+
+        drawDamaged(pointerBox, [&]
+                    { canvas.drawWedgeLine(sx - 1, sy - 82, sx - 1, sy - 70, 1, 5, 0xA380, TFT_BLACK); });
+        pushDamage();
+        stats.frameMicros = micros() - frameStart;
+        frameTimes.record(stats.frameMicros);
+    }
+
+    // Smooth-sweep mode: the bezel angle is interpolated from micros() since
+    // the start of the second. Frames are paced at 60 fps while they fit the
+    // budget; when they do not, the rate steps down to 30 and then 20 fps
+    // rather than leaving the loop no time for input.
+    void drawSweepFrame()
+    {
+        unsigned long t = micros();
+        if (faceValid && t - lastSweepFrame < sweepIntervals[sweepRate])
+            return;
+        lastSweepFrame = t;
+
+        uint32_t fraction = min(t - secondEdge, 999999UL); // Microseconds into the second
+        drawClockFace(now.second() * secondStep + fraction * secondStep / 1000000);
+
+        sweepCost = (sweepCost * 7 + stats.frameMicros) / 8;
+        if (sweepRate < 2 && sweepCost > sweepIntervals[sweepRate] * 4 / 5)
+            sweepRate++;
+        else if (sweepRate > 0 && sweepCost < sweepIntervals[sweepRate - 1] / 2)
+            sweepRate--;
     }
 
     void drawSettingsMenu()
@@ -156,26 +504,28 @@ private:
                 break;
             }
         }
-        sprite.fillSprite(TFT_BLACK);
-        sprite.loadFont(middleFont);
-        sprite.setTextColor(TFT_WHITE, TFT_BLACK);
-
+        clearScreen();
+        selectFont(middleFontPacked);
+        canvas.setTextColor(TFT_WHITE, TFT_BLACK);
 
-        for (int i = 0; i < totalOptions; i++)
         {
-            if (i == highlighedOption)
+            PROFILE_STAGE(profiler, TEXT);
+            for (int i = 0; i < totalOptions; i++)
             {
-                sprite.setTextColor(TFT_ORANGE, TFT_BLACK);
-            }
-            else
-            {
-                sprite.setTextColor(TFT_WHITE, TFT_BLACK);
+                if (i == highlighedOption)
+                {
+                    canvas.setTextColor(TFT_ORANGE, TFT_BLACK);
+                }
+                else
+                {
+                    canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+                }
+
+                canvas.drawCentreString(options[i], 120, 60 + i * 50);
             }
-            
-            sprite.drawCentreString(options[i], 120, 60 + i * 50, 1);
         }
 
-        M5Dial.Display.pushImage(0, 0, 240, 240, (uint16_t *)sprite.getPointer());
+        pushFullFrame();
     }
 
     void drawBrightnessPicker()
@@ -197,7 +547,7 @@ private:
         if (M5Dial.BtnA.wasPressed())
         {
             M5Dial.Display.setBrightness(brightness);
-            preferences.putUInt("brightness", brightness); // Save brightness to preferences
+            settings.save(Settings{brightness}); // One RTC RAM write; NVS is backed up later
             currentMode = SETTINGS_MENU; // Return to settings menu on button press
             needsRedraw = true;
             return; // No need to redraw as we are exiting
@@ -205,9 +555,13 @@ private:
 
         if (needsRedraw)
         {
-            sprite.fillSprite(TFT_BLACK);
-            sprite.setTextColor(TFT_WHITE, TFT_BLACK);
-            sprite.drawCentreString("Brightness", 120, 200, 2); // Text at the bottom
+            clearScreen();
+            selectFont(middleFontPacked);
+            {
+                PROFILE_STAGE(profiler, TEXT);
+                canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+                canvas.drawCentreString("Brightness", 120, 200); // Text at the bottom
+            }
 
             // Draw the arc for brightness
             int startAngle = 30;  // Start angle in degrees
@@ -220,16 +574,19 @@ private:
             int angle = map(brightness, 0, 255, startAngle, endAngle);
 
             // Draw the arc background
-            sprite.drawSmoothArc(cx, cy, radiusInner, radiusOuter, startAngle, endAngle, TFT_DARKGREY, TFT_BLACK, true);
+            canvas.drawSmoothArc(cx, cy, radiusInner, radiusOuter, startAngle, endAngle, TFT_DARKGREY, TFT_BLACK, true);
 
             // Draw the filled arc for the current brightness
-            sprite.drawSmoothArc(cx, cy, radiusInner, radiusOuter, startAngle, angle, TFT_ORANGE, TFT_BLACK, true);
+            canvas.drawSmoothArc(cx, cy, radiusInner, radiusOuter, startAngle, angle, TFT_ORANGE, TFT_BLACK, true);
 
             // Display the brightness value in the center
-            sprite.setTextColor(TFT_WHITE, TFT_BLACK);
-            sprite.drawCentreString(String(map(brightness, 5, 250, 2, 100)) + "%", 120, 120, 9);
+            {
+                PROFILE_STAGE(profiler, TEXT);
+                canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+                canvas.drawCentreString(TimeText::number(map(brightness, 5, 250, 2, 100), '%').c_str(), 120, 120);
+            }
 
-            M5Dial.Display.pushImage(0, 0, 240, 240, (uint16_t *)sprite.getPointer());
+            pushFullFrame();
 
             needsRedraw = false; // Reset the redraw flag after drawing
         }
@@ -246,7 +603,7 @@ private:
 
     void drawTimePicker()
     {
-        now = rtc.now(); // Get the current time
+        now.advanceTo(softClock.unixSeconds()); // Get the current time
         int encoderValue = M5Dial.Encoder.read() / 4;
         bool needsRedraw = false;
 
@@ -330,7 +687,7 @@ private:
                 tpState.editMode = false;
                 if (tpState.selectedField != 3) // Save time only if not on Back field
                 {
-                    rtc.adjust(DateTime(now.year(), now.month(), now.day(), hour, minute, second));
+                    softClock.adjust(DateTime(now.year(), now.month(), now.day(), hour, minute, second));
                 }
             }
             needsRedraw = true;
@@ -339,7 +696,7 @@ private:
         // Allow time flow in edit mode
         if (!tpState.editMode)
         {
-            now = rtc.now();
+            now.advanceTo(softClock.unixSeconds());
             hour = now.hour();
             minute = now.minute();
             second = now.second();
@@ -369,32 +726,34 @@ private:
         unsigned long currentMillis = millis();
         if (needsRedraw || tpState.editMode != tpState.lastEditMode || currentMillis - tpState.lastRedrawTime >= 1000)
         {
-            sprite.fillSprite(TFT_BLACK);
-            sprite.setTextColor(TFT_WHITE, TFT_BLACK);
-            sprite.loadFont(middleFont);
-            sprite.drawCentreString("Time Picker", 120, 30, 1);
+            clearScreen();
+            canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+            selectFont(middleFontPacked);
+            {
+                PROFILE_STAGE(profiler, TEXT);
+                canvas.drawCentreString("Time Picker", 120, 30);
 
-            // Display the time with the selected field highlighted or in edit mode
-            String h = hour < 10 ? "0" + String(hour) : String(hour);
-            String m = minute < 10 ? "0" + String(minute) : String(minute);
-            String s = second < 10 ? "0" + String(second) : String(second);
+                // Display the time with the selected field highlighted or in edit mode
+                TimeText h = TimeText::twoDigits(hour);
+                TimeText m = TimeText::twoDigits(minute);
+                TimeText s = TimeText::twoDigits(second);
 
-            sprite.setTextColor(tpState.selectedField == 0 ? (tpState.editMode ? TFT_RED : TFT_ORANGE) : TFT_WHITE, TFT_BLACK);
-            sprite.drawCentreString(h, 60, 120, 4);
+                canvas.setTextColor(tpState.selectedField == 0 ? (tpState.editMode ? TFT_RED : TFT_ORANGE) : TFT_WHITE, TFT_BLACK);
+                canvas.drawCentreString(h.c_str(), 60, 120);
 
-            sprite.setTextColor(tpState.selectedField == 1 ? (tpState.editMode ? TFT_RED : TFT_ORANGE) : TFT_WHITE, TFT_BLACK);
-            sprite.drawCentreString(":", 100, 120, 4);
-            sprite.drawCentreString(m, 120, 120, 4);
+                canvas.setTextColor(tpState.selectedField == 1 ? (tpState.editMode ? TFT_RED : TFT_ORANGE) : TFT_WHITE, TFT_BLACK);
+                canvas.drawCentreString(":", 100, 120);
+                canvas.drawCentreString(m.c_str(), 120, 120);
 
-            sprite.setTextColor(tpState.selectedField == 2 ? (tpState.editMode ? TFT_RED : TFT_ORANGE) : TFT_WHITE, TFT_BLACK);
-            sprite.drawCentreString(":", 160, 120, 4);
-            sprite.drawCentreString(s, 180, 120, 4);
+                canvas.setTextColor(tpState.selectedField == 2 ? (tpState.editMode ? TFT_RED : TFT_ORANGE) : TFT_WHITE, TFT_BLACK);
+                canvas.drawCentreString(":", 160, 120);
+                canvas.drawCentreString(s.c_str(), 180, 120);
 
-            sprite.setTextColor(tpState.selectedField == 3 ? TFT_ORANGE : TFT_WHITE, TFT_BLACK);
-            sprite.drawCentreString("Back", 120, 180, 2);
+                canvas.setTextColor(tpState.selectedField == 3 ? TFT_ORANGE : TFT_WHITE, TFT_BLACK);
+                canvas.drawCentreString("Back", 120, 180);
+            }
 
-            sprite.unloadFont();
-            M5Dial.Display.pushImage(0, 0, 240, 240, (uint16_t *)sprite.getPointer());
+            pushFullFrame();
 
             // Update last known states
             tpState.lastEditMode = tpState.editMode;
@@ -403,21 +762,58 @@ private:
     }
 
 public:
-    Display(M5Canvas &img, TFT_eSprite &sprite, TFT_eSPI &tft, RTC_DS1307 &rtc, Preferences &preferences)
-        : img(img), tft(tft), sprite(sprite), rtc(rtc), preferences(preferences) {}
+    Display(RenderTarget &target, DS1307 &rtc, Preferences &preferences, int sqwPin = RTC_SQW_PIN)
+        : canvas(target), softClock(rtc, sqwPin), settings(rtc, preferences) {}
 
     void begin()
     {
-        sprite.createSprite(240, 240);
-        sprite.setSwapBytes(true);
-        sprite.setTextDatum(4);
+        canvas.begin();
+        canvas.setTextDatum(Canvas::MC_DATUM);
+        fonts.add(secFontPacked);
+        fonts.add(bigFontPacked);
+        fonts.add(NotoPacked);
+        fonts.add(middleFontPacked);
 
-        initializeCoordinates();
         initializeGrayscale();
+        initializePalettes();
+        canvas.setPalette(facePalette, 16);
+        initializeFaceLayout();
+        initializeDigitAtlases();
+        initializeDotLayer();
+        initializeTickCache();
+        softClock.begin();
+        now.set(softClock.now());
+        settings.load();
+        brightness = settings.current().brightness;
+        M5Dial.Display.setBrightness(brightness);
+        residentAllocations = VlwFont::allocations();
+#if FRAME_PROFILER
+        profiler.calibrate();
+#endif
+    }
+
+    const FrameStats &frameStats() const { return stats; }
+    const FrameHistogram &frameHistogram() const { return frameTimes; }
+    const SoftClock &clock() const { return softClock; }
+    const SettingsStore &settingsStore() const { return settings; }
+#if FRAME_PROFILER
+    void dumpProfile(Print &out) const { profiler.dump(out); }
+#endif
+
+    void setSmoothSweep(bool enabled)
+    {
+        smoothSweep = enabled;
+        sweepRate = 0;
+        faceValid = false;
     }
 
+    // Frame rate the sweep is currently paced at
+    int sweepFps() const { return smoothSweep ? (1000000 + sweepIntervals[sweepRate] / 2) / sweepIntervals[sweepRate] : 1; }
+
     void loop()
     {
+        softClock.update();
+        settings.update();
         if (M5Dial.BtnA.wasPressed() && currentMode == CLOCK)
         {
             currentMode = SETTINGS_MENU;
@@ -427,13 +823,14 @@ public:
         {
         case CLOCK:
         {
-            static int lastSecond = -1;
-            now = rtc.now();
-            if (now.second() != lastSecond)
-            {
-                lastSecond = now.second();
-                drawClockFace();
-            }
+            bool newSecond = now.advanceTo(softClock.unixSeconds()) != 0;
+            if (newSecond || !faceValid)
+                secondEdge = (unsigned long)softClock.secondStartMicros();
+
+            if (smoothSweep)
+                drawSweepFrame();
+            else if (newSecond || !faceValid)
+                drawClockFace(now.second() * secondStep);
         }
         break;
 
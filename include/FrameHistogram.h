@@ -0,0 +1,96 @@
+#ifndef FRAME_HISTOGRAM_H
+#define FRAME_HISTOGRAM_H
+
+#include <stdint.h>
+
+// Frame times in log-spaced buckets: 1 us wide below 32 us, then 32 to each
+// doubling, so a bucket is never more than about 3% of the time it holds
+// (256 us at 8-16 ms, 512 us at 16-33 ms). The last bucket collects
+// everything from 32.8 ms up. Percentiles and the budget count interpolate
+// inside a bucket, taking its frames as spread evenly across it.
+class FrameHistogram
+{
+public:
+    static constexpr int subBuckets = 32;
+    static constexpr int octaves = 10; // 32 us to 32.8 ms
+    static constexpr int buckets = subBuckets * (octaves + 1) + 1;
+    static constexpr uint32_t overflowMicros = (uint32_t)subBuckets << octaves;
+
+private:
+    uint32_t counts[buckets] = {};
+    uint32_t total = 0;
+
+public:
+    static int bucketOf(uint32_t micros)
+    {
+        if (micros < subBuckets)
+            return micros;
+        if (micros >= overflowMicros)
+            return buckets - 1;
+        int shift = 31 - __builtin_clz(micros) - 5; // Octave above the linear buckets
+        return (shift + 1) * subBuckets + (micros >> shift) - subBuckets;
+    }
+
+    static uint32_t lowerMicros(int b)
+    {
+        if (b < subBuckets)
+            return b;
+        if (b == buckets - 1)
+            return overflowMicros;
+        int shift = b / subBuckets - 1;
+        return (uint32_t)(subBuckets + b % subBuckets) << shift;
+    }
+
+    static uint32_t widthMicros(int b) { return b < subBuckets ? 1 : 1u << (b / subBuckets - 1); }
+
+    void record(uint32_t micros)
+    {
+        counts[bucketOf(micros)]++;
+        total++;
+    }
+
+    void reset()
+    {
+        for (int i = 0; i < buckets; i++)
+            counts[i] = 0;
+        total = 0;
+    }
+
+    uint32_t samples() const { return total; }
+    uint32_t bucket(int i) const { return counts[i]; }
+
+    // Percentage of frames that took no longer than budgetMicros
+    float withinBudget(uint32_t budgetMicros) const
+    {
+        if (!total)
+            return 100.0f;
+        if (budgetMicros >= overflowMicros)
+            return 100.0f * (total - counts[buckets - 1]) / total;
+        int last = bucketOf(budgetMicros);
+        float n = 0;
+        for (int b = 0; b < last; b++)
+            n += counts[b];
+        n += counts[last] * (float)(budgetMicros - lowerMicros(last) + 1) / widthMicros(last);
+        return 100.0f * n / total;
+    }
+
+    // The pct-th percentile, interpolated inside its bucket; frames past the
+    // last bucket's start count as overflowMicros
+    uint32_t percentileMicros(int pct) const
+    {
+        if (!total)
+            return 0;
+        uint32_t rank = (uint64_t)total * pct / 100, seen = 0;
+        if (rank >= total)
+            rank = total - 1;
+        for (int b = 0; b < buckets - 1; b++)
+        {
+            if (seen + counts[b] > rank)
+                return lowerMicros(b) + (uint32_t)((uint64_t)widthMicros(b) * (2 * (rank - seen) + 1) / (2 * counts[b]));
+            seen += counts[b];
+        }
+        return overflowMicros;
+    }
+};
+
+#endif // FRAME_HISTOGRAM_H
@@ -0,0 +1,144 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#ifndef FRAME_PROFILER
+#define FRAME_PROFILER 0 // 1 times every render stage; 0 compiles the probes out
+#endif
+
+#if FRAME_PROFILER
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Per-stage render timings. Scoped probes add to the current frame's total
+// for their stage; endFrame() moves the totals of the stages that ran into a
+// fixed ring per stage, from which min/mean/max/p99 are summarised.
+class FrameProfiler
+{
+public:
+    enum Stage
+    {
+        CLEAR,
+        FONT,
+        TEXT,
+        TICKS,
+        DOTS,
+        PUSH,
+        STAGES
+    };
+
+    static constexpr int window = 128; // Frames kept per stage
+
+    struct Summary
+    {
+        uint32_t min, mean, max, p99;
+        int samples;
+    };
+
+    class Scope
+    {
+    private:
+        FrameProfiler &profiler;
+        Stage stage;
+        unsigned long start;
+
+    public:
+        Scope(FrameProfiler &profiler, Stage stage) : profiler(profiler), stage(stage), start(micros()) {}
+        ~Scope() { profiler.add(stage, micros() - start); }
+    };
+
+private:
+    uint32_t ring[STAGES][window];
+    int head[STAGES] = {};
+    int filled[STAGES] = {};
+    uint32_t current[STAGES] = {};
+    uint32_t ran = 0; // Bit per stage that ran in the current frame
+    uint32_t frames = 0;
+    uint32_t probeNanos = 0;
+
+public:
+    void add(Stage stage, uint32_t micros)
+    {
+        current[stage] += micros;
+        ran |= 1u << stage;
+    }
+
+    void endFrame()
+    {
+        for (int s = 0; s < STAGES; s++)
+        {
+            if (!(ran & 1u << s))
+                continue;
+            ring[s][head[s]] = current[s];
+            head[s] = (head[s] + 1) % window;
+            if (filled[s] < window)
+                filled[s]++;
+            current[s] = 0;
+        }
+        ran = 0;
+        frames++;
+    }
+
+    // Times a batch of empty probes, so the dump can say what one costs
+    void calibrate()
+    {
+        constexpr int probes = 1000;
+        unsigned long start = micros();
+        for (int i = 0; i < probes; i++)
+            Scope probe(*this, FONT);
+        probeNanos = (micros() - start) * 1000 / probes;
+        current[FONT] = 0;
+        ran = 0;
+    }
+
+    Summary summary(Stage stage) const
+    {
+        Summary out = {0, 0, 0, 0, filled[stage]};
+        if (!out.samples)
+            return out;
+
+        uint32_t sorted[window];
+        uint64_t total = 0;
+        for (int i = 0; i < out.samples; i++)
+        {
+            uint32_t v = ring[stage][i];
+            total += v;
+            int j = i;
+            for (; j > 0 && sorted[j - 1] > v; j--)
+                sorted[j] = sorted[j - 1];
+            sorted[j] = v;
+        }
+        out.min = sorted[0];
+        out.max = sorted[out.samples - 1];
+        out.mean = total / out.samples;
+        out.p99 = sorted[(out.samples * 99 + 99) / 100 - 1];
+        return out;
+    }
+
+    void dump(Print &out) const
+    {
+        static const char *const names[STAGES] = {"clear", "font", "text", "ticks", "dots", "push"};
+        out.printf("frame profile: %u frames, %u ns per probe\n", (unsigned)frames, (unsigned)probeNanos);
+        out.printf("stage      min   mean    max    p99  (us)\n");
+        for (int s = 0; s < STAGES; s++)
+        {
+            Summary m = summary((Stage)s);
+            if (m.samples)
+                out.printf("%-6s %6u %6u %6u %6u\n", names[s], (unsigned)m.min, (unsigned)m.mean, (unsigned)m.max, (unsigned)m.p99);
+        }
+    }
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_STAGE(profiler, stage) FrameProfiler::Scope PROFILE_CONCAT(profileScope, __LINE__)(profiler, FrameProfiler::stage)
+#define PROFILE_END_FRAME(profiler) (profiler).endFrame()
+
+#else
+
+#define PROFILE_STAGE(profiler, stage) do { } while (0)
+#define PROFILE_END_FRAME(profiler) do { } while (0)
+
+#endif // FRAME_PROFILER
+
+#endif // FRAME_PROFILER_H
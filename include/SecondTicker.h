@@ -0,0 +1,194 @@
+#ifndef SECOND_TICKER_H
+#define SECOND_TICKER_H
+
+#include <Arduino.h>
+#include "DS1307.h"
+#include "RTClib.h"
+#include "esp_timer.h"
+
+#ifndef RTC_SQW_PIN
+#define RTC_SQW_PIN -1 // GPIO wired to the DS1307's SQW/OUT, -1 when it is not wired
+#endif
+
+// Catches the DS1307's seconds register turning over: a read says what
+// second it is, and only the moment it changes says where in the second
+// the RTC is. With SQW wired, the DS1307 runs its 1 Hz square wave, whose
+// falling edge comes with the seconds update, and the edge is timed by an
+// interrupt and the RTC read once. Without it, or when no edge has come
+// for a while, the RTC is polled from just before the expected change until
+// it shows. Reads go through the driver's queue, so the loop never waits
+// on the bus; the driver's poll() must run before poll() here. Times are
+// esp_timer microseconds.
+class SecondTicker
+{
+public:
+    struct Sample
+    {
+        DateTime time;           // The second that had just begun
+        int64_t edgeMicros;      // When it began
+        int64_t toleranceMicros; // The edge is within this of edgeMicros
+    };
+
+private:
+    static constexpr int64_t retryMicros = 2000;      // Between reads while polling for the change
+    static constexpr int64_t scanMicros = 25000;      // The same when it could come any time
+    static constexpr int64_t leadMicros = 20000;      // Polling starts this long before the change is due
+    static constexpr int64_t silenceMicros = 2500000; // Without an edge for this long, poll
+    static constexpr int64_t giveUpMicros = 1500000;  // A search that sees no change stops (RTC halted)
+
+    // Written by the interrupt
+    static inline volatile uint32_t edges = 0;
+    static inline volatile int64_t lastEdgeMicros = 0;
+
+    DS1307 &rtc;
+    int pin;
+    uint32_t edgesSeen = 0;
+    bool haveEdge = false;
+    int64_t edgeAt = 0;  // Latest edge, or begin() until the first
+    bool searching = false;
+    int64_t from = 0;    // Search start
+    uint32_t due = 0;    // The second expected to begin, 0 if unknown
+    int64_t retry = 0;   // Between reads in this search
+    int64_t readAt = 0;  // Time of the search's latest read, 0 before the first
+    int lastSecond = -1; // What that read showed
+    uint32_t readCount = 0;
+    bool edgeDue = false;     // An edge ended the search; the next read gives its second
+    bool reading = false;     // A read is queued or on the bus
+    bool readForEdge = false; // It was made after the edge
+    bool readDone = false;
+    bool readOk = false;
+
+    static void IRAM_ATTR onEdge()
+    {
+        edges = edges + 1;
+        lastEdgeMicros = esp_timer_get_time();
+    }
+
+    static void onRead(DS1307 &, bool ok, void *self)
+    {
+        SecondTicker &ticker = *(SecondTicker *)self;
+        ticker.readDone = true;
+        ticker.readOk = ok;
+    }
+
+    void read()
+    {
+        if (!rtc.getTimeAsync(onRead, this))
+            return;
+        readCount++;
+        reading = true;
+        readDone = false;
+        readForEdge = edgeDue;
+    }
+
+    void end()
+    {
+        searching = false;
+        edgeDue = false;
+    }
+
+    // Whether a polling search reads on this pass
+    bool pollDue() const
+    {
+        int64_t t = esp_timer_get_time();
+        if (t < from || (pin >= 0 && t - edgeAt < silenceMicros))
+            return false;
+        return !readAt || t - readAt >= retry;
+    }
+
+    // A finished read: the second the edge began, or a polling step
+    bool examine(Sample &sample)
+    {
+        DateTime now = timeOf(rtc);
+        int64_t t = rtc.timeMicros;
+        if (readForEdge)
+        {
+            sample = {now, edgeAt, 0};
+            end();
+            return true;
+        }
+        if (readAt && now.second() != lastSecond)
+        {
+            sample = {now, (readAt + t) / 2, (t - readAt) / 2};
+            end();
+            return true;
+        }
+        if (!readAt && due && now.unixtime() >= due)
+            retry = scanMicros; // Started after the change; find the next one coarsely
+        if (t - from > giveUpMicros)
+            end();
+        readAt = t;
+        lastSecond = now.second();
+        return false;
+    }
+
+public:
+    SecondTicker(DS1307 &rtc, int sqwPin) : rtc(rtc), pin(sqwPin) {}
+
+    static DateTime timeOf(const DS1307 &rtc)
+    {
+        return DateTime(2000 + rtc.year, rtc.month, rtc.dayOfMonth, rtc.hour, rtc.minute, rtc.second);
+    }
+
+    void begin()
+    {
+        if (pin < 0)
+            return;
+        rtc.setSquareWave(DS1307_SQW_1HZ);
+        pinMode(pin, INPUT_PULLUP); // SQW/OUT is open drain
+        attachInterrupt(digitalPinToInterrupt(pin), onEdge, FALLING);
+        edgesSeen = edges;
+        edgeAt = esp_timer_get_time();
+    }
+
+    // Looks for the change to unix second dueSecond, expected at dueMicros;
+    // both 0 when it could come any time, which polls coarsely for up to a
+    // second
+    void expect(int64_t dueMicros, uint32_t dueSecond)
+    {
+        searching = true;
+        edgeDue = false;
+        from = dueMicros ? dueMicros - leadMicros : esp_timer_get_time();
+        due = dueSecond;
+        retry = dueMicros ? retryMicros : scanMicros;
+        readAt = 0;
+    }
+
+    bool busy() const { return searching; }
+    void cancel() { end(); }
+
+    // Reads the RTC if the search needs it; true once the change is caught
+    bool poll(Sample &sample)
+    {
+        if (pin >= 0 && edges != edgesSeen)
+        {
+            noInterrupts();
+            uint32_t n = edges;
+            edgeAt = lastEdgeMicros;
+            interrupts();
+            edgesSeen = n;
+            haveEdge = true;
+            if (searching && edgeAt >= from)
+                edgeDue = true;
+        }
+        if (reading)
+        {
+            if (!readDone)
+                return false;
+            reading = false;
+            if (readOk && searching && examine(sample))
+                return true;
+        }
+        if (searching && (edgeDue || pollDue()))
+            read();
+        return false;
+    }
+
+    // RTC reads made by searches
+    uint32_t reads() const { return readCount; }
+
+    // Whether changes currently come from SQW edges rather than polling
+    bool usingInterrupt() const { return haveEdge && esp_timer_get_time() - edgeAt < silenceMicros; }
+};
+
+#endif // SECOND_TICKER_H
@@ -0,0 +1,151 @@
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <stdint.h>
+#include "DS1307.h"
+
+// What the user sets
+struct Settings
+{
+    uint8_t brightness = 65;
+};
+
+// Settings in the DS1307's battery-backed RAM, with NVS behind them. A
+// save is one short I2C write queued on the RTC driver, so the loop never
+// waits on flash. NVS gets a copy once the settings have stood unchanged
+// for backupDelay, and load() falls back on it when the record is missing
+// or damaged: a new battery, a first boot, a write cut off.
+//
+// The record, at the start of the RTC's RAM: magic, version, payload
+// length, the payload, then a CRC-16/CCITT of all of those, low byte first.
+class SettingsStore
+{
+public:
+    enum Source : uint8_t
+    {
+        DEFAULTS,
+        NVRAM,
+        NVS
+    };
+
+    static constexpr uint8_t recordBytes = 6;
+
+private:
+    static constexpr uint8_t magic = 0xC5;
+    static constexpr uint8_t version = 1;
+    static constexpr uint8_t payloadBytes = recordBytes - 5;
+    static constexpr uint32_t backupDelay = 300000; // ms
+
+    DS1307 &rtc;
+    Preferences &nvs;
+    Settings values;
+    Source loadedFrom = DEFAULTS;
+    bool backupDue = false;
+    uint32_t changedAt = 0; // millis() of the latest save
+    uint32_t failureCount = 0;
+    uint32_t backupCount = 0;
+
+    static uint16_t crc16(const uint8_t *p, int n)
+    {
+        uint16_t crc = 0xFFFF;
+        for (int i = 0; i < n; i++)
+        {
+            crc ^= p[i] << 8;
+            for (int bit = 0; bit < 8; bit++)
+                crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+        return crc;
+    }
+
+    void encode(uint8_t *record) const
+    {
+        record[0] = magic;
+        record[1] = version;
+        record[2] = payloadBytes;
+        record[3] = values.brightness;
+        uint16_t crc = crc16(record, recordBytes - 2);
+        record[recordBytes - 2] = crc & 0xFF;
+        record[recordBytes - 1] = crc >> 8;
+    }
+
+    bool decode(const uint8_t *record)
+    {
+        if (record[0] != magic || record[1] != version || record[2] != payloadBytes)
+            return false;
+        if (crc16(record, recordBytes - 2) != (record[recordBytes - 2] | record[recordBytes - 1] << 8))
+            return false;
+        values.brightness = record[3];
+        return true;
+    }
+
+    // Writes the record; a write that fails is backed up to NVS at once
+    void write()
+    {
+        encode(rtc.ram);
+        if (!rtc.setRamAsync(0, recordBytes, onWritten, this))
+            failed();
+    }
+
+    void failed()
+    {
+        failureCount++;
+        backupDue = true;
+        changedAt = millis() - backupDelay;
+    }
+
+    static void onWritten(DS1307 &, bool ok, void *self)
+    {
+        if (!ok)
+            ((SettingsStore *)self)->failed();
+    }
+
+public:
+    SettingsStore(DS1307 &rtc, Preferences &nvs) : rtc(rtc), nvs(nvs) {}
+
+    // For begin(): reads the record, waiting on the bus, or failing that NVS
+    // or the defaults, and then rewrites a record that was not good
+    Source load()
+    {
+        if (rtc.getRam() && decode(rtc.ram))
+            loadedFrom = NVRAM;
+        else
+        {
+            loadedFrom = nvs.isKey("brightness") ? NVS : DEFAULTS;
+            values.brightness = nvs.getUInt("brightness", values.brightness);
+            write();
+        }
+        return loadedFrom;
+    }
+
+    const Settings &current() const { return values; }
+
+    void save(const Settings &settings)
+    {
+        values = settings;
+        backupDue = true;
+        changedAt = millis(); // Before write(), whose failure brings the backup forward
+        write();
+    }
+
+    // Call every loop pass, after the RTC driver's poll(); the NVS backup,
+    // which does wait on flash, happens here and rarely
+    void update()
+    {
+        if (!backupDue || millis() - changedAt < backupDelay)
+            return;
+        backupDue = false;
+        if (nvs.getUInt("brightness", ~0u) != values.brightness)
+        {
+            nvs.putUInt("brightness", values.brightness);
+            backupCount++;
+        }
+    }
+
+    Source source() const { return loadedFrom; }
+    uint32_t failures() const { return failureCount; }
+    uint32_t backups() const { return backupCount; }
+};
+
+#endif // SETTINGS_STORE_H
@@ -0,0 +1,202 @@
+#ifndef SOFT_CLOCK_H
+#define SOFT_CLOCK_H
+
+#include <stdint.h>
+#include "DS1307.h"
+#include "RTClib.h"
+#include "SecondTicker.h"
+#include "esp_timer.h"
+
+// Wall-clock time from the esp_timer counter, disciplined by the DS1307.
+// The RTC is read once at boot and then about once a minute, at a change
+// of its second, which SecondTicker catches; everything else reads the
+// counter. Each sync measures how far the software clock is from the RTC
+// and slews that away at no more than slewPpm, so time never jumps or runs
+// backwards; only errors over stepMicros (the first sync after boot or a
+// setting) are stepped. Half of each error is also taken as a difference in
+// rate between the two crystals, which the counter is then scaled by.
+class SoftClock
+{
+public:
+    struct Drift
+    {
+        uint32_t syncs = 0;
+        uint32_t steps = 0;
+        int32_t lastMicros = 0;      // RTC minus software clock at the latest slewed sync
+        int32_t worstMicros = 0;     // Largest of those in size
+        int32_t toleranceMicros = 0; // How closely the latest sync timed the RTC's edge
+        int32_t ratePpb = 0;         // How much faster the RTC runs
+    };
+
+private:
+    static constexpr int64_t syncInterval = 60; // Seconds between syncs
+    static constexpr int64_t stepMicros = 250000;
+    static constexpr int64_t roughMicros = 5000; // A sync timed worse than this is redone soon
+    static constexpr int64_t slewPpm = 500;
+    static constexpr int64_t maxRatePpb = 500000;
+
+    DS1307 &rtc;
+    SecondTicker ticker;
+    int64_t offset = 0;     // Unix microseconds minus esp_timer microseconds, before slewing
+    int64_t slewStart = 0;  // esp_timer time the current slew began
+    int64_t slewTotal = 0;  // Microseconds it adds to offset in all
+    int64_t rateStart = 0;  // esp_timer time the rate was last folded into offset
+    int64_t lastSyncAt = 0; // esp_timer time of the latest well-timed sync, 0 if none
+    int64_t nextSync = 0;   // Unix second of the next sync
+    uint32_t bootReads = 0;
+    bool unwritten = false; // The RTC did not take the latest adjust()
+    Drift drift;
+
+    // Microseconds of the current slew applied by t
+    int64_t slewed(int64_t t) const
+    {
+        int64_t most = (t - slewStart) * slewPpm / 1000000;
+        if (slewTotal >= 0)
+            return slewTotal < most ? slewTotal : most;
+        return -slewTotal < most ? slewTotal : -most;
+    }
+
+    int64_t rated(int64_t t) const { return (t - rateStart) * drift.ratePpb / 1000000000; }
+
+    int64_t unixMicrosAt(int64_t t) const { return t + offset + rated(t) + slewed(t); }
+
+    void step(int64_t unixMicros, int64_t t)
+    {
+        offset = unixMicros - t;
+        rateStart = t;
+        slewTotal = 0;
+        lastSyncAt = 0;
+        drift.steps++;
+    }
+
+    void sync(const SecondTicker::Sample &sample)
+    {
+        int64_t rtcMicros = (int64_t)sample.time.unixtime() * 1000000;
+        int64_t error = rtcMicros - unixMicrosAt(sample.edgeMicros);
+        int64_t t = esp_timer_get_time();
+        bool fine = sample.toleranceMicros <= roughMicros;
+        if (error > stepMicros || error < -stepMicros)
+            step(rtcMicros + (t - sample.edgeMicros), t);
+        else
+        {
+            // Fold in the rate and slew so far, then start the new ones from here
+            offset += rated(t) + slewed(t);
+            rateStart = slewStart = t;
+            slewTotal = error;
+            drift.lastMicros = (int32_t)error;
+            if (error > drift.worstMicros || -error > drift.worstMicros)
+                drift.worstMicros = (int32_t)(error < 0 ? -error : error);
+            if (lastSyncAt)
+            {
+                int64_t rate = drift.ratePpb + error * 500000000 / (sample.edgeMicros - lastSyncAt);
+                drift.ratePpb = (int32_t)(rate > maxRatePpb ? maxRatePpb : rate < -maxRatePpb ? -maxRatePpb : rate);
+            }
+            lastSyncAt = fine ? sample.edgeMicros : 0;
+        }
+        drift.syncs++;
+        drift.toleranceMicros = (int32_t)sample.toleranceMicros;
+        nextSync = sample.time.unixtime() + (fine ? syncInterval : 2);
+    }
+
+    static void written(DS1307 &, bool ok, void *self)
+    {
+        if (!ok)
+            ((SoftClock *)self)->unwritten = true;
+    }
+
+    // Writes the time this clock is about to reach, waiting for the bus,
+    // and confirms it with a sync as adjust() does; tries again later if
+    // the RTC still does not answer
+    void rewrite(uint32_t second)
+    {
+        unwritten = !write(rtc, DateTime(second));
+        nextSync = second + 2;
+    }
+
+public:
+    SoftClock(DS1307 &rtc, int sqwPin) : rtc(rtc), ticker(rtc, sqwPin) {}
+
+    // Sets the RTC and waits for the bus; for setup(). False if it did not answer.
+    static bool write(DS1307 &rtc, const DateTime &time)
+    {
+        fill(rtc, time);
+        return rtc.setTime();
+    }
+
+    static void fill(DS1307 &rtc, const DateTime &time)
+    {
+        rtc.fillByYMD(time.year(), time.month(), time.day());
+        rtc.fillByHMS(time.hour(), time.minute(), time.second());
+        rtc.fillDayOfWeek(time.dayOfTheWeek() ? time.dayOfTheWeek() : SUN);
+    }
+
+    // Sets the time from one read, to within a second; the edge search
+    // started here brings it within a few milliseconds
+    void begin()
+    {
+        ticker.begin();
+        bootReads++;
+        if (rtc.getTime())
+            step((int64_t)SecondTicker::timeOf(rtc).unixtime() * 1000000, rtc.timeMicros);
+        nextSync = unixMicros() / 1000000 + syncInterval;
+        ticker.expect(0, 0);
+    }
+
+    // Call every loop pass; reads the RTC only while a sync is due. Finishes
+    // every request on the RTC, this clock's and any other.
+    void update()
+    {
+        rtc.poll();
+        SecondTicker::Sample sample;
+        if (ticker.poll(sample))
+        {
+            if (!unwritten) // Otherwise the RTC still has the old time
+                sync(sample);
+        }
+        else if (!ticker.busy())
+        {
+            int64_t t = esp_timer_get_time();
+            int64_t due = nextSync * 1000000 - unixMicrosAt(t); // Until the RTC should tick over
+            if (due < 100000 && unwritten)
+                rewrite((uint32_t)nextSync);
+            else if (due < 100000)
+            {
+                ticker.expect(t + due, (uint32_t)nextSync);
+                nextSync += syncInterval; // If this search fails, the next one
+            }
+        }
+    }
+
+    DateTime now() const { return DateTime(unixSeconds()); }
+    uint32_t unixSeconds() const { return (uint32_t)(unixMicros() / 1000000); }
+    int64_t unixMicros() const { return unixMicrosAt(esp_timer_get_time()); }
+
+    // esp_timer time the current second began, to within the slew rate
+    int64_t secondStartMicros() const
+    {
+        int64_t t = esp_timer_get_time();
+        return t - unixMicrosAt(t) % 1000000;
+    }
+
+    // Sets the RTC, whose second restarts with the write, and this clock
+    // with it; a sync soon after confirms the RTC's phase. With the queue
+    // full the write waits for the bus instead, and one that fails is made
+    // again, at the next second, before that sync.
+    void adjust(const DateTime &time)
+    {
+        ticker.cancel(); // A read already on its way has the old time
+        fill(rtc, time);
+        unwritten = !rtc.setTimeAsync(written, this) && !rtc.setTime();
+        step((int64_t)time.unixtime() * 1000000, esp_timer_get_time());
+        nextSync = time.unixtime() + 2;
+    }
+
+    // False while the RTC has yet to take the latest adjust()
+    bool rtcWritten() const { return !unwritten; }
+
+    const Drift &driftStats() const { return drift; }
+    uint32_t rtcReads() const { return ticker.reads() + bootReads; }
+    bool usingInterrupt() const { return ticker.usingInterrupt(); }
+};
+
+#endif // SOFT_CLOCK_H
@@ -0,0 +1,74 @@
+#ifndef TIME_TEXT_H
+#define TIME_TEXT_H
+
+#include <stdint.h>
+
+// Short text built in place, for the clock and picker labels. Nothing here
+// touches the heap, unlike String concatenation.
+class TimeText
+{
+private:
+    char text[13] = {}; // A full int32, a suffix and the terminator
+
+    void put(int &at, int v) // Two digits, 0..99
+    {
+        text[at++] = '0' + v / 10 % 10;
+        text[at++] = '0' + v % 10;
+    }
+
+public:
+    static TimeText twoDigits(int v)
+    {
+        TimeText t;
+        int at = 0;
+        t.put(at, v);
+        return t;
+    }
+
+    // HH:MM
+    static TimeText hourMinute(int h, int m)
+    {
+        TimeText t;
+        int at = 0;
+        t.put(at, h);
+        t.text[at++] = ':';
+        t.put(at, m);
+        return t;
+    }
+
+    // HH:MM:SS
+    static TimeText hourMinuteSecond(int h, int m, int s)
+    {
+        TimeText t = hourMinute(h, m);
+        int at = 5;
+        t.text[at++] = ':';
+        t.put(at, s);
+        return t;
+    }
+
+    // Decimal, optionally followed by one suffix character
+    static TimeText number(int32_t v, char suffix = 0)
+    {
+        TimeText t;
+        char digits[10];
+        uint32_t u = v < 0 ? 0u - (uint32_t)v : (uint32_t)v;
+        int n = 0;
+        do
+        {
+            digits[n++] = '0' + u % 10;
+            u /= 10;
+        } while (u);
+
+        int at = 0;
+        if (v < 0)
+            t.text[at++] = '-';
+        while (n)
+            t.text[at++] = digits[--n];
+        t.text[at] = suffix;
+        return t;
+    }
+
+    const char *c_str() const { return text; }
+};
+
+#endif // TIME_TEXT_H
@@ -0,0 +1,71 @@
+// Packed by tools/packfont.py from Noto.h, only the glyphs Display.h draws with it; do not edit
+alignas(4) const uint8_t NotoPacked[] PROGMEM = {
+    0x50, 0x56, 0x4C, 0x57, 0x12, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x2A, 0x00, 0x08, 0x08,
+    0x08, 0x00, 0x0C, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x0C, 0x09, 0x00, 0x0B, 0x00,
+    0x05, 0x01, 0x00, 0x00, 0x31, 0x00, 0x06, 0x0B, 0x09, 0x01, 0x0B, 0x00, 0x37, 0x01, 0x00, 0x00,
+    0x32, 0x00, 0x09, 0x0B, 0x09, 0x00, 0x0B, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x33, 0x00, 0x08, 0x0C,
+    0x09, 0x00, 0x0B, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x34, 0x00, 0x09, 0x0B, 0x09, 0x00, 0x0B, 0x00,
+    0xC0, 0x01, 0x00, 0x00, 0x35, 0x00, 0x08, 0x0C, 0x09, 0x00, 0x0B, 0x00, 0xF1, 0x01, 0x00, 0x00,
+    0x36, 0x00, 0x09, 0x0C, 0x09, 0x00, 0x0B, 0x00, 0x23, 0x02, 0x00, 0x00, 0x37, 0x00, 0x09, 0x0B,
+    0x09, 0x00, 0x0B, 0x00, 0x5A, 0x02, 0x00, 0x00, 0x38, 0x00, 0x08, 0x0C, 0x09, 0x00, 0x0B, 0x00,
+    0x88, 0x02, 0x00, 0x00, 0x39, 0x00, 0x08, 0x0C, 0x09, 0x00, 0x0B, 0x00, 0xBB, 0x02, 0x00, 0x00,
+    0x41, 0x00, 0x0B, 0x0B, 0x0A, 0x00, 0x0B, 0x00, 0xEC, 0x02, 0x00, 0x00, 0x45, 0x00, 0x07, 0x0B,
+    0x08, 0x01, 0x0B, 0x00, 0x27, 0x03, 0x00, 0x00, 0x49, 0x00, 0x06, 0x0B, 0x06, 0x00, 0x0B, 0x00,
+    0x4F, 0x03, 0x00, 0x00, 0x4C, 0x00, 0x07, 0x0B, 0x08, 0x01, 0x0B, 0x00, 0x78, 0x03, 0x00, 0x00,
+    0x4E, 0x00, 0x0A, 0x0B, 0x0C, 0x01, 0x0B, 0x00, 0xA2, 0x03, 0x00, 0x00, 0x50, 0x00, 0x08, 0x0B,
+    0x09, 0x01, 0x0B, 0x00, 0xDF, 0x03, 0x00, 0x00, 0x53, 0x00, 0x08, 0x0C, 0x08, 0x00, 0x0B, 0x00,
+    0x0C, 0x04, 0x00, 0x00, 0x02, 0x81, 0x55, 0x05, 0x81, 0xEB, 0x02, 0xA6, 0x42, 0xA0, 0x0C, 0x33,
+    0xF5, 0xDE, 0xED, 0x9F, 0x62, 0xF9, 0xBF, 0x36, 0x00, 0xEB, 0xDD, 0x01, 0x60, 0x8F, 0xF5, 0x08,
+    0x02, 0x85, 0x15, 0x60, 0x00, 0x89, 0x00, 0xC7, 0xAD, 0x02, 0x80, 0x43, 0xBF, 0x1E, 0xF0, 0x5F,
+    0xB0, 0x8F, 0xF4, 0x0E, 0x50, 0xCF, 0xF5, 0x0C, 0x40, 0xFF, 0xF6, 0x0B, 0x40, 0xFF, 0xF5, 0x0C,
+    0x40, 0xFF, 0xF5, 0x0E, 0x50, 0xEF, 0xF1, 0x2F, 0x90, 0xAF, 0x90, 0xDF, 0xFB, 0x88, 0x4F, 0x10,
+    0xFA, 0xEF, 0x06, 0x04, 0x80, 0x01, 0x02, 0x9D, 0x00, 0xA1, 0x2A, 0x40, 0xFE, 0x4F, 0xF6, 0xFE,
+    0x4F, 0xDB, 0xF3, 0x4F, 0x11, 0xF0, 0x4F, 0x02, 0x82, 0xFF, 0x04, 0x02, 0x82, 0xFF, 0x04, 0x02,
+    0x82, 0xFF, 0x04, 0x02, 0x82, 0xFF, 0x04, 0x02, 0x82, 0xFF, 0x04, 0x02, 0x82, 0xFF, 0x04, 0x8A,
+    0x10, 0xB8, 0xAD, 0x04, 0x20, 0x0E, 0x44, 0x89, 0x04, 0xB0, 0x29, 0xB0, 0xAF, 0x05, 0x82, 0xF7,
+    0x0A, 0x05, 0x82, 0xFC, 0x07, 0x04, 0x82, 0xF8, 0x0D, 0x04, 0x83, 0xF7, 0x2D, 0x03, 0x83, 0xF7,
+    0x2D, 0x03, 0x83, 0xF7, 0x1C, 0x03, 0x89, 0xF4, 0xEF, 0xEE, 0xEE, 0x50, 0x46, 0x80, 0x00, 0x88,
+    0x50, 0xCA, 0xAD, 0x04, 0x03, 0x45, 0x88, 0x05, 0x46, 0x00, 0xFC, 0x0A, 0x04, 0x91, 0xF9, 0x08,
+    0x40, 0x85, 0xCF, 0x01, 0xB0, 0xFF, 0x4D, 0x02, 0x85, 0x54, 0xE7, 0x8F, 0x04, 0x83, 0xF6, 0x1E,
+    0x03, 0x8C, 0xF8, 0x5E, 0xAE, 0xBA, 0xFF, 0x48, 0x0D, 0x42, 0x81, 0x7E, 0x03, 0x81, 0x11, 0x02,
+    0x03, 0x82, 0xA3, 0x0A, 0x05, 0x82, 0xFC, 0x0F, 0x04, 0x80, 0x08, 0x42, 0x03, 0x84, 0xF3, 0xF8,
+    0x0F, 0x03, 0x84, 0xDD, 0xF2, 0x0F, 0x02, 0x91, 0xF8, 0x34, 0xFF, 0x00, 0xF4, 0x09, 0xF4, 0x0F,
+    0xA0, 0x46, 0x89, 0x75, 0xBB, 0xCB, 0xFF, 0x3B, 0x03, 0x82, 0xF4, 0x0F, 0x05, 0x84, 0xF4, 0x0F,
+    0x00, 0x89, 0x70, 0xAA, 0xAA, 0x1A, 0xA0, 0x44, 0x8C, 0x01, 0xFB, 0x47, 0x44, 0x00, 0xFE, 0x04,
+    0x04, 0x88, 0xFF, 0xDB, 0x4A, 0x00, 0x0E, 0x44, 0x88, 0x05, 0x11, 0x20, 0xFC, 0x0B, 0x04, 0x84,
+    0xF6, 0x1E, 0x01, 0x02, 0x8C, 0xF9, 0x4B, 0xBF, 0xCA, 0xFF, 0x35, 0x0D, 0x42, 0x81, 0x5D, 0x03,
+    0x80, 0x01, 0x03, 0x02, 0x88, 0xA6, 0xBB, 0x03, 0x10, 0x0C, 0x43, 0x86, 0x05, 0x90, 0xBF, 0x02,
+    0x03, 0x82, 0xF1, 0x0E, 0x05, 0xB8, 0xF5, 0x7A, 0xEE, 0x19, 0x50, 0xEF, 0xBF, 0xFF, 0x09, 0xF6,
+    0x2E, 0x50, 0xFF, 0x50, 0xBF, 0x00, 0xF1, 0x0F, 0xF2, 0x2F, 0x50, 0xEF, 0x00, 0xFA, 0xAD, 0xFE,
+    0x08, 0x10, 0x09, 0x42, 0x80, 0x09, 0x05, 0x80, 0x01, 0x03, 0x89, 0xA6, 0xAA, 0xAA, 0xAA, 0x90,
+    0x46, 0x88, 0x20, 0x44, 0x44, 0xF9, 0x0B, 0x05, 0x82, 0xFD, 0x04, 0x04, 0x82, 0xF5, 0x0D, 0x05,
+    0x82, 0xFC, 0x06, 0x04, 0x82, 0xF4, 0x0E, 0x05, 0x82, 0xFB, 0x08, 0x04, 0x83, 0xF2, 0x2F, 0x04,
+    0x82, 0xF9, 0x0A, 0x04, 0x83, 0xF2, 0x3F, 0x03, 0xAA, 0x10, 0xB7, 0xAC, 0x04, 0xB0, 0xEF, 0xFC,
+    0x5F, 0xF1, 0x1F, 0x80, 0xAF, 0xF0, 0x3F, 0x90, 0x8F, 0x60, 0xEF, 0xFB, 0x1C, 0x00, 0x0C, 0x42,
+    0xA4, 0x03, 0xC0, 0xBF, 0xF7, 0x5F, 0xF5, 0x0C, 0x40, 0xEF, 0xF6, 0x0A, 0x20, 0xFF, 0xF3, 0xAF,
+    0xD9, 0xAF, 0x50, 0x0D, 0x42, 0x81, 0x19, 0x02, 0x81, 0x11, 0x02, 0x89, 0x10, 0xB7, 0x8B, 0x01,
+    0xB0, 0x43, 0xA3, 0x1E, 0xF4, 0x2E, 0xB0, 0x9F, 0xF7, 0x0A, 0x40, 0xEF, 0xF6, 0x0B, 0x50, 0xFF,
+    0xF3, 0x9F, 0xE7, 0xFF, 0x80, 0x42, 0x8A, 0xF7, 0x0E, 0x20, 0x24, 0xF4, 0x0A, 0x03, 0x91, 0xC1,
+    0x5F, 0x70, 0xA9, 0xFE, 0x0B, 0xB0, 0xFF, 0x8E, 0x03, 0x81, 0x11, 0x03, 0x02, 0x83, 0xB4, 0x7B,
+    0x06, 0x80, 0x09, 0x42, 0x06, 0x84, 0xFE, 0xFA, 0x05, 0x04, 0x85, 0xF5, 0x5A, 0xAF, 0x04, 0x86,
+    0xFA, 0x16, 0xFF, 0x01, 0x02, 0x87, 0xF1, 0x2F, 0xB0, 0x6F, 0x02, 0x87, 0xF6, 0x6E, 0xA6, 0xBF,
+    0x02, 0x80, 0x0B, 0x46, 0x8F, 0x02, 0xF2, 0x7F, 0x66, 0xD6, 0x7F, 0x70, 0xDF, 0x03, 0x86, 0xF8,
+    0x0C, 0xFC, 0x09, 0x03, 0x83, 0xF3, 0x2F, 0x87, 0xA7, 0xAA, 0xAA, 0xA6, 0x44, 0x8A, 0xA9, 0xAF,
+    0x11, 0x11, 0xFA, 0x09, 0x03, 0x87, 0xFA, 0x9D, 0x99, 0xA2, 0x44, 0x8A, 0xA4, 0xBF, 0x55, 0x15,
+    0xFA, 0x09, 0x03, 0x82, 0xFA, 0x09, 0x03, 0x87, 0xFA, 0xEF, 0xEE, 0xA8, 0x44, 0x80, 0x09, 0x86,
+    0xA6, 0xAA, 0x3A, 0x06, 0x42, 0x85, 0x3E, 0x40, 0xFF, 0x02, 0x82, 0xF4, 0x0F, 0x02, 0x82, 0xF4,
+    0x0F, 0x02, 0x82, 0xF4, 0x0F, 0x02, 0x82, 0xF4, 0x0F, 0x02, 0x82, 0xF4, 0x0F, 0x02, 0x8B, 0xF4,
+    0x0F, 0x30, 0xFB, 0xAF, 0x92, 0x43, 0x80, 0x05, 0x82, 0xA7, 0x06, 0x03, 0x82, 0xFA, 0x09, 0x03,
+    0x82, 0xFA, 0x09, 0x03, 0x82, 0xFA, 0x09, 0x03, 0x82, 0xFA, 0x09, 0x03, 0x82, 0xFA, 0x09, 0x03,
+    0x82, 0xFA, 0x09, 0x03, 0x82, 0xFA, 0x09, 0x03, 0x82, 0xFA, 0x09, 0x03, 0x87, 0xFA, 0xEF, 0xEE,
+    0xAD, 0x45, 0x83, 0xA7, 0x4A, 0x02, 0x86, 0xA2, 0xA9, 0xFF, 0x0D, 0x02, 0x83, 0xF4, 0xAD, 0x42,
+    0xBF, 0x07, 0x40, 0xDF, 0xFA, 0xF9, 0x1E, 0x40, 0xDF, 0xFA, 0xB4, 0x9F, 0x40, 0xDF, 0xFA, 0x35,
+    0xFF, 0x43, 0xDF, 0xFA, 0x05, 0xF9, 0x2C, 0xDF, 0xFA, 0x05, 0xE1, 0x6F, 0xDF, 0xFA, 0x05, 0x70,
+    0xEF, 0x84, 0xDF, 0xFA, 0x05, 0x02, 0x86, 0xFD, 0xDF, 0xFA, 0x05, 0x02, 0x83, 0xF4, 0xDF, 0x88,
+    0xA7, 0xAA, 0x7A, 0x01, 0x0A, 0x44, 0xA2, 0x2E, 0xFA, 0x1A, 0xE5, 0x8F, 0xFA, 0x09, 0x90, 0xAF,
+    0xFA, 0x09, 0xB0, 0xAF, 0xFA, 0xAD, 0xFD, 0x4F, 0x0A, 0x43, 0x87, 0x5D, 0xA0, 0xBF, 0x13, 0x02,
+    0x82, 0xFA, 0x09, 0x04, 0x82, 0xFA, 0x09, 0x04, 0x82, 0xFA, 0x09, 0x04, 0x89, 0x00, 0xB7, 0xBD,
+    0x28, 0xA0, 0x44, 0x8C, 0x16, 0xFF, 0x04, 0x72, 0x20, 0xFF, 0x02, 0x04, 0x83, 0xFD, 0x7E, 0x03,
+    0x85, 0xD2, 0xFF, 0x5E, 0x03, 0x84, 0xD7, 0xFF, 0x03, 0x03, 0x85, 0xC1, 0x9F, 0x43, 0x02, 0x8C,
+    0xFA, 0x59, 0xEF, 0xBA, 0xFF, 0x34, 0x0C, 0x42, 0x81, 0x5D, 0x03, 0x81, 0x11, 0x02,
+};
@@ -0,0 +1,96 @@
+// Packed by tools/packfont.py from bigFont.h, only the glyphs Display.h draws with it; do not edit
+alignas(4) const uint8_t bigFontPacked[] PROGMEM = {
+    0x50, 0x56, 0x4C, 0x57, 0x0B, 0x00, 0x2F, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x30, 0x00, 0x0F, 0x26,
+    0x15, 0x03, 0x26, 0x00, 0x90, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x26, 0x09, 0x02, 0x26, 0x00,
+    0xEB, 0x00, 0x00, 0x00, 0x32, 0x00, 0x10, 0x26, 0x16, 0x03, 0x26, 0x00, 0x59, 0x01, 0x00, 0x00,
+    0x33, 0x00, 0x0F, 0x26, 0x15, 0x03, 0x26, 0x00, 0x04, 0x02, 0x00, 0x00, 0x34, 0x00, 0x11, 0x26,
+    0x13, 0x01, 0x26, 0x00, 0xA2, 0x02, 0x00, 0x00, 0x35, 0x00, 0x0F, 0x26, 0x15, 0x03, 0x26, 0x00,
+    0x3E, 0x03, 0x00, 0x00, 0x36, 0x00, 0x0F, 0x26, 0x15, 0x03, 0x26, 0x00, 0xB2, 0x03, 0x00, 0x00,
+    0x37, 0x00, 0x0F, 0x26, 0x11, 0x02, 0x26, 0x00, 0x11, 0x04, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x26,
+    0x15, 0x03, 0x26, 0x00, 0xA8, 0x04, 0x00, 0x00, 0x39, 0x00, 0x0F, 0x26, 0x15, 0x03, 0x26, 0x00,
+    0x61, 0x05, 0x00, 0x00, 0x3A, 0x00, 0x03, 0x15, 0x07, 0x02, 0x15, 0x00, 0xC0, 0x05, 0x00, 0x00,
+    0x82, 0x80, 0x0E, 0x48, 0x83, 0x8E, 0x80, 0x4C, 0x81, 0xE8, 0x4C, 0x80, 0x0E, 0x42, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x42, 0x80, 0x0E,
+    0x4C, 0x81, 0x8E, 0x4C, 0x83, 0x08, 0xE8, 0x48, 0x82, 0x8E, 0x00, 0x90, 0x70, 0xFF, 0x90, 0xFF,
+    0xB0, 0xFF, 0xE0, 0xFF, 0x01, 0x42, 0x80, 0x03, 0x42, 0x80, 0x05, 0x42, 0x80, 0x08, 0x42, 0x80,
+    0x0A, 0x42, 0x80, 0x0C, 0x42, 0x80, 0x0E, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00,
+    0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42,
+    0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80,
+    0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00,
+    0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42,
+    0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x80, 0x00, 0x42, 0x83, 0x00, 0xE9, 0x48, 0x84, 0x8E, 0x00,
+    0x08, 0x4C, 0x82, 0x08, 0x0E, 0x4C, 0x81, 0x0E, 0x42, 0x08, 0x42, 0x80, 0x00, 0x42, 0x08, 0x42,
+    0x80, 0x00, 0x42, 0x08, 0x42, 0x80, 0x00, 0x42, 0x08, 0x42, 0x80, 0x00, 0x42, 0x08, 0x42, 0x80,
+    0x00, 0x42, 0x08, 0x42, 0x80, 0x00, 0x42, 0x08, 0x42, 0x80, 0x00, 0x42, 0x08, 0x42, 0x80, 0x00,
+    0x42, 0x08, 0x82, 0xFF, 0x0D, 0x0B, 0x83, 0xF6, 0x9F, 0x0A, 0x84, 0xE1, 0xFF, 0x03, 0x0A, 0x83,
+    0xF7, 0xBF, 0x0A, 0x84, 0xE1, 0xFF, 0x03, 0x0A, 0x83, 0xF8, 0xAF, 0x0A, 0x80, 0x02, 0x42, 0x80,
+    0x03, 0x0A, 0x83, 0xF9, 0xAF, 0x0A, 0x80, 0x03, 0x42, 0x80, 0x02, 0x0A, 0x83, 0xFB, 0x9F, 0x0A,
+    0x84, 0xF4, 0xEF, 0x02, 0x0A, 0x83, 0xFC, 0x8F, 0x0A, 0x84, 0xF5, 0xEF, 0x01, 0x0A, 0x83, 0xFC,
+    0x7F, 0x0A, 0x84, 0xF6, 0xEF, 0x01, 0x0A, 0x83, 0xFD, 0x7F, 0x0A, 0x83, 0xF7, 0xDF, 0x0A, 0x84,
+    0xE1, 0xFF, 0x06, 0x0A, 0x83, 0xF8, 0xDF, 0x0A, 0x84, 0xE1, 0xFF, 0x05, 0x0A, 0x83, 0xF9, 0xCF,
+    0x0A, 0x80, 0x02, 0x42, 0x80, 0x05, 0x0A, 0x83, 0xFA, 0xCF, 0x0A, 0x80, 0x03, 0x42, 0x80, 0x04,
+    0x0A, 0x80, 0x0B, 0x6E, 0x82, 0x80, 0x0E, 0x48, 0x83, 0x7E, 0x80, 0x4C, 0x81, 0xD7, 0x4C, 0x84,
+    0xED, 0xFF, 0x01, 0x06, 0x87, 0xF1, 0xEF, 0xFE, 0x1F, 0x06, 0x87, 0xF1, 0xEF, 0xFE, 0x1F, 0x06,
+    0x87, 0xF1, 0xEF, 0xFE, 0x1F, 0x06, 0x87, 0xF1, 0xEF, 0xFE, 0x1F, 0x06, 0x87, 0xF1, 0xEF, 0xFE,
+    0x1F, 0x06, 0x87, 0xF1, 0xEF, 0xFE, 0x1F, 0x06, 0x87, 0xF1, 0xEF, 0xFE, 0x1F, 0x06, 0x87, 0xF1,
+    0xEF, 0xFE, 0x1F, 0x06, 0x83, 0xF1, 0xEF, 0x0A, 0x83, 0xF8, 0xBF, 0x08, 0x85, 0xC2, 0xFF, 0x3E,
+    0x07, 0x85, 0xE6, 0xFF, 0x2B, 0x06, 0x85, 0xA1, 0xFF, 0x6E, 0x07, 0x85, 0xD4, 0xFF, 0x19, 0x08,
+    0x42, 0x80, 0x06, 0x0A, 0x85, 0xD4, 0xFF, 0x19, 0x09, 0x85, 0xA1, 0xFF, 0x6E, 0x0A, 0x80, 0x06,
+    0x42, 0x81, 0x3C, 0x09, 0x81, 0xC3, 0x42, 0x80, 0x04, 0x0A, 0x83, 0xF9, 0xCF, 0x0B, 0x42, 0x0B,
+    0x42, 0x0B, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x45, 0x08, 0x42, 0x80, 0x0E, 0x4C, 0x81, 0x8E, 0x4C, 0x83, 0x08, 0xE8, 0x48, 0x82,
+    0x8E, 0x00, 0x08, 0x83, 0xFE, 0x2F, 0x0B, 0x83, 0xF4, 0xCF, 0x0C, 0x83, 0xFA, 0x6F, 0x0B, 0x84,
+    0xE1, 0xFF, 0x01, 0x0B, 0x83, 0xF5, 0xBF, 0x0C, 0x83, 0xFA, 0x5F, 0x0B, 0x84, 0xF1, 0xEF, 0x01,
+    0x0B, 0x83, 0xF6, 0xAF, 0x0C, 0x83, 0xFB, 0x4F, 0x0B, 0x83, 0xF2, 0xEF, 0x0C, 0x83, 0xF7, 0x9F,
+    0x0C, 0x85, 0xFC, 0x4F, 0x00, 0x42, 0x06, 0x83, 0xF2, 0xDF, 0x02, 0x42, 0x06, 0x83, 0xF8, 0x8F,
+    0x02, 0x42, 0x06, 0x83, 0xFD, 0x3F, 0x02, 0x42, 0x05, 0x83, 0xF3, 0xCF, 0x03, 0x42, 0x05, 0x83,
+    0xF8, 0x7F, 0x03, 0x42, 0x05, 0x83, 0xFE, 0x2F, 0x03, 0x42, 0x04, 0x83, 0xF4, 0xBF, 0x04, 0x42,
+    0x04, 0x83, 0xF9, 0x6F, 0x04, 0x42, 0x04, 0x83, 0xFE, 0x1F, 0x04, 0x42, 0x03, 0x83, 0xF5, 0xBF,
+    0x05, 0x42, 0x03, 0x83, 0xFA, 0x5F, 0x05, 0x42, 0x02, 0x84, 0xF1, 0xEF, 0x01, 0x05, 0x42, 0x02,
+    0x83, 0xF6, 0xAF, 0x06, 0x42, 0x02, 0x80, 0x0B, 0x71, 0x0A, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D,
+    0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x0D, 0x42, 0x02, 0x80, 0x08,
+    0x4D, 0x80, 0x08, 0x4D, 0x80, 0x09, 0x4D, 0x83, 0xF9, 0x6F, 0x0A, 0x83, 0xF9, 0x5F, 0x0A, 0x83,
+    0xFA, 0x5F, 0x0A, 0x83, 0xFA, 0x4F, 0x0A, 0x83, 0xFB, 0x4F, 0x0A, 0x83, 0xFB, 0x3F, 0x0A, 0x83,
+    0xFC, 0x3F, 0x0A, 0x83, 0xFC, 0x2F, 0x0A, 0x83, 0xFC, 0x2F, 0x0A, 0x83, 0xFD, 0x1F, 0x0A, 0x83,
+    0xFD, 0x1F, 0x0A, 0x82, 0xFE, 0x0F, 0x0B, 0x80, 0x0E, 0x4A, 0x83, 0x9E, 0xE1, 0x4C, 0x80, 0x09,
+    0x4D, 0x80, 0x0E, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+    0x42, 0x0B, 0x42, 0x0B, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x45, 0x08, 0x42, 0x80, 0x0E, 0x4C, 0x81, 0x9E, 0x4C, 0x83, 0x19, 0xE9, 0x48, 0x82,
+    0x9E, 0x01, 0x82, 0x80, 0x0E, 0x48, 0x83, 0x8E, 0x80, 0x4C, 0x81, 0xE8, 0x4C, 0x80, 0x0E, 0x42,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x4B, 0x82, 0x9E, 0x01, 0x4D,
+    0x80, 0x0A, 0x4D, 0x80, 0x0E, 0x42, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x42, 0x80, 0x0E, 0x4C, 0x81, 0x8E, 0x4C, 0x83, 0x08, 0xE8, 0x48, 0x82, 0x8E,
+    0x00, 0x6B, 0x80, 0x0D, 0x42, 0x07, 0x83, 0xF2, 0x9F, 0x42, 0x07, 0x83, 0xF5, 0x6F, 0x42, 0x07,
+    0x83, 0xF9, 0x3F, 0x42, 0x07, 0x83, 0xFC, 0x0E, 0x42, 0x06, 0x84, 0xF1, 0xBF, 0x00, 0x42, 0x06,
+    0x83, 0xF4, 0x8F, 0x0A, 0x83, 0xF7, 0x4F, 0x0A, 0x83, 0xFB, 0x1F, 0x0A, 0x82, 0xFE, 0x0D, 0x0A,
+    0x83, 0xF3, 0x9F, 0x0A, 0x83, 0xF6, 0x6F, 0x0A, 0x83, 0xF9, 0x3F, 0x0A, 0x82, 0xFD, 0x0E, 0x0A,
+    0x83, 0xF1, 0xBF, 0x0A, 0x83, 0xF5, 0x8F, 0x0A, 0x83, 0xF8, 0x5F, 0x0A, 0x83, 0xFC, 0x1F, 0x0A,
+    0x82, 0xFF, 0x0D, 0x0A, 0x83, 0xF3, 0xAF, 0x0A, 0x83, 0xF7, 0x6F, 0x0A, 0x83, 0xFA, 0x3F, 0x0A,
+    0x82, 0xFE, 0x0E, 0x0A, 0x83, 0xF2, 0xBF, 0x0A, 0x83, 0xF6, 0x8F, 0x0A, 0x83, 0xF9, 0x5F, 0x0A,
+    0x83, 0xFC, 0x1F, 0x09, 0x83, 0xF1, 0xDF, 0x0A, 0x83, 0xF4, 0xAF, 0x0A, 0x83, 0xF8, 0x6F, 0x0A,
+    0x83, 0xFB, 0x3F, 0x0A, 0x82, 0xFE, 0x0F, 0x0A, 0x83, 0xF3, 0xCF, 0x0A, 0x83, 0xF6, 0x8F, 0x0A,
+    0x83, 0xFA, 0x5F, 0x0A, 0x83, 0xFD, 0x2F, 0x06, 0x82, 0x60, 0x0D, 0x48, 0x83, 0x7E, 0x60, 0x4C,
+    0x81, 0xC6, 0x4C, 0x84, 0xEC, 0xFF, 0x02, 0x06, 0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2,
+    0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06,
+    0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFE,
+    0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2,
+    0xEF, 0xFE, 0x2F, 0x06, 0x87, 0xF2, 0xEF, 0xFC, 0x8F, 0x06, 0x84, 0xF8, 0xCF, 0x04, 0x42, 0x81,
+    0x3C, 0x02, 0x81, 0xD3, 0x42, 0x83, 0x04, 0xE6, 0x42, 0x82, 0x18, 0x08, 0x42, 0x81, 0x5E, 0x02,
+    0x81, 0xB2, 0x46, 0x81, 0x2B, 0x05, 0x80, 0x0A, 0x44, 0x80, 0x0A, 0x05, 0x81, 0xA1, 0x46, 0x81,
+    0x1A, 0x02, 0x81, 0xE5, 0x42, 0x82, 0x29, 0x09, 0x42, 0x83, 0x4E, 0x60, 0x42, 0x81, 0x4D, 0x02,
+    0x81, 0xD4, 0x42, 0x84, 0xC5, 0xFF, 0x08, 0x06, 0x83, 0xF8, 0xCF, 0x42, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45,
+    0x08, 0x45, 0x08, 0x42, 0x80, 0x0E, 0x4C, 0x81, 0x8E, 0x4C, 0x83, 0x07, 0xE8, 0x48, 0x82, 0x7E,
+    0x00, 0x82, 0x90, 0x0E, 0x48, 0x83, 0x8E, 0x80, 0x4C, 0x81, 0xE8, 0x4C, 0x80, 0x0E, 0x42, 0x08,
+    0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x42, 0x80, 0x0E, 0x4D,
+    0x80, 0x0A, 0x4D, 0x82, 0xA1, 0x0E, 0x4B, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+    0x42, 0x0B, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x42, 0x80, 0x0E, 0x4C, 0x81, 0x8E, 0x4C, 0x83, 0x08, 0xE8, 0x48, 0x82, 0x8E, 0x00,
+    0x4B, 0x26, 0x4B,
+};
@@ -0,0 +1,135 @@
+// Packed by tools/packfont.py from middleFont.h, only the glyphs Display.h draws with it; do not edit
+alignas(4) const uint8_t middleFontPacked[] PROGMEM = {
+    0x50, 0x56, 0x4C, 0x57, 0x1F, 0x00, 0x18, 0x00, 0x06, 0x00, 0x07, 0x00, 0x25, 0x00, 0x0F, 0x14,
+    0x11, 0x01, 0x14, 0x00, 0x80, 0x01, 0x00, 0x00, 0x30, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00,
+    0x1E, 0x02, 0x00, 0x00, 0x31, 0x00, 0x03, 0x14, 0x05, 0x01, 0x14, 0x00, 0x51, 0x02, 0x00, 0x00,
+    0x32, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00, 0x70, 0x02, 0x00, 0x00, 0x33, 0x00, 0x08, 0x14,
+    0x0A, 0x01, 0x14, 0x00, 0xB4, 0x02, 0x00, 0x00, 0x34, 0x00, 0x0A, 0x14, 0x0A, 0x00, 0x14, 0x00,
+    0xF8, 0x02, 0x00, 0x00, 0x35, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00, 0x4A, 0x03, 0x00, 0x00,
+    0x36, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00, 0x83, 0x03, 0x00, 0x00, 0x37, 0x00, 0x08, 0x14,
+    0x08, 0x00, 0x14, 0x00, 0xBA, 0x03, 0x00, 0x00, 0x38, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00,
+    0x05, 0x04, 0x00, 0x00, 0x39, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00, 0x4D, 0x04, 0x00, 0x00,
+    0x3A, 0x00, 0x02, 0x0B, 0x04, 0x01, 0x0B, 0x00, 0x84, 0x04, 0x00, 0x00, 0x42, 0x00, 0x08, 0x14,
+    0x0A, 0x01, 0x14, 0x00, 0x87, 0x04, 0x00, 0x00, 0x4D, 0x00, 0x0B, 0x14, 0x0D, 0x01, 0x14, 0x00,
+    0xCA, 0x04, 0x00, 0x00, 0x50, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00, 0x3D, 0x05, 0x00, 0x00,
+    0x53, 0x00, 0x08, 0x14, 0x0A, 0x01, 0x14, 0x00, 0x70, 0x05, 0x00, 0x00, 0x54, 0x00, 0x08, 0x14,
+    0x08, 0x00, 0x14, 0x00, 0xB6, 0x05, 0x00, 0x00, 0x61, 0x00, 0x07, 0x0C, 0x09, 0x01, 0x0C, 0x00,
+    0xEE, 0x05, 0x00, 0x00, 0x63, 0x00, 0x07, 0x0C, 0x09, 0x01, 0x0C, 0x00, 0x15, 0x06, 0x00, 0x00,
+    0x65, 0x00, 0x07, 0x0C, 0x09, 0x01, 0x0C, 0x00, 0x3C, 0x06, 0x00, 0x00, 0x67, 0x00, 0x07, 0x12,
+    0x09, 0x01, 0x0C, 0x00, 0x60, 0x06, 0x00, 0x00, 0x68, 0x00, 0x07, 0x14, 0x09, 0x01, 0x14, 0x00,
+    0x95, 0x06, 0x00, 0x00, 0x69, 0x00, 0x04, 0x11, 0x04, 0x00, 0x11, 0x00, 0xCF, 0x06, 0x00, 0x00,
+    0x6B, 0x00, 0x07, 0x14, 0x08, 0x01, 0x14, 0x00, 0xF0, 0x06, 0x00, 0x00, 0x6C, 0x00, 0x02, 0x14,
+    0x04, 0x01, 0x14, 0x00, 0x35, 0x07, 0x00, 0x00, 0x6D, 0x00, 0x0C, 0x0C, 0x0E, 0x01, 0x0C, 0x00,
+    0x36, 0x07, 0x00, 0x00, 0x6E, 0x00, 0x07, 0x0C, 0x09, 0x01, 0x0C, 0x00, 0x79, 0x07, 0x00, 0x00,
+    0x72, 0x00, 0x07, 0x0C, 0x08, 0x01, 0x0C, 0x00, 0x97, 0x07, 0x00, 0x00, 0x73, 0x00, 0x07, 0x0C,
+    0x09, 0x01, 0x0C, 0x00, 0xBA, 0x07, 0x00, 0x00, 0x74, 0x00, 0x05, 0x10, 0x05, 0x00, 0x10, 0x00,
+    0xE6, 0x07, 0x00, 0x00, 0x75, 0x00, 0x07, 0x0C, 0x09, 0x01, 0x0C, 0x00, 0x14, 0x08, 0x00, 0x00,
+    0x81, 0xA1, 0x42, 0x81, 0x1B, 0x04, 0x83, 0xC4, 0xA0, 0x44, 0x80, 0x0B, 0x04, 0x84, 0x3C, 0xF0,
+    0x0F, 0x02, 0x81, 0xFF, 0x03, 0x85, 0xA6, 0x00, 0xFF, 0x02, 0x81, 0xFF, 0x02, 0x86, 0xD1, 0x02,
+    0xF0, 0x0F, 0x02, 0x81, 0xFF, 0x02, 0x81, 0x97, 0x02, 0x81, 0xFF, 0x02, 0x86, 0xFF, 0x00, 0xD1,
+    0x01, 0x02, 0x81, 0xFF, 0x02, 0x85, 0xFF, 0x00, 0x79, 0x03, 0x81, 0xFF, 0x02, 0x84, 0xFF, 0x20,
+    0x0D, 0x04, 0x80, 0x0B, 0x44, 0x83, 0x0B, 0x5B, 0x04, 0x81, 0xB1, 0x42, 0x83, 0x2B, 0xC4, 0x0C,
+    0x82, 0x5C, 0x0A, 0x42, 0x81, 0x1B, 0x05, 0x82, 0xB5, 0x0A, 0x44, 0x80, 0x0B, 0x05, 0x83, 0x2D,
+    0xFF, 0x02, 0x81, 0xFF, 0x04, 0x84, 0x97, 0xF0, 0x0F, 0x02, 0x81, 0xFF, 0x03, 0x85, 0xD1, 0x01,
+    0xFF, 0x02, 0x81, 0xFF, 0x03, 0x85, 0x79, 0x00, 0xFF, 0x02, 0x81, 0xFF, 0x02, 0x86, 0xD2, 0x01,
+    0xF0, 0x0F, 0x02, 0x81, 0xFF, 0x02, 0x81, 0x6A, 0x02, 0x81, 0xFF, 0x02, 0x85, 0xFF, 0x00, 0xC3,
+    0x03, 0x80, 0x0B, 0x44, 0x84, 0x0B, 0xC0, 0x04, 0x03, 0x81, 0xB1, 0x42, 0x81, 0x2B, 0x81, 0xB1,
+    0x43, 0x82, 0x1A, 0x0A, 0x45, 0x82, 0xFA, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x82, 0xFF, 0x0A, 0x45, 0x82, 0x1A, 0x0B, 0x43, 0x81,
+    0x1A, 0xBB, 0x80, 0x0F, 0xFC, 0xF1, 0x6F, 0xFF, 0xFA, 0xEF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF,
+    0x81, 0xB1, 0x43, 0x82, 0x1B, 0x0A, 0x45, 0x82, 0xFA, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x81, 0xEF, 0x04, 0x82, 0xF1, 0x0B, 0x04, 0x82, 0xF8, 0x04, 0x03, 0x82, 0xE1, 0x0C, 0x04,
+    0x82, 0xF7, 0x04, 0x03, 0x82, 0xE1, 0x0B, 0x04, 0x82, 0xF7, 0x04, 0x04, 0x81, 0xBD, 0x04, 0x82,
+    0xF6, 0x04, 0x04, 0x81, 0xBD, 0x04, 0x82, 0xF5, 0x04, 0x04, 0x81, 0xBC, 0x04, 0x82, 0xF4, 0x04,
+    0x04, 0x80, 0x0B, 0x4E, 0x81, 0xA1, 0x43, 0x82, 0x1A, 0x0A, 0x45, 0x82, 0xEA, 0x0F, 0x03, 0x83,
+    0xEF, 0xFF, 0x03, 0x43, 0x03, 0x43, 0x03, 0x81, 0xFF, 0x04, 0x82, 0xF1, 0x0E, 0x03, 0x83, 0xC2,
+    0x8F, 0x02, 0x83, 0xD3, 0x6E, 0x03, 0x82, 0xFE, 0x05, 0x04, 0x83, 0xE3, 0x6E, 0x04, 0x83, 0xC2,
+    0x8F, 0x04, 0x82, 0xF1, 0x0E, 0x05, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x82, 0xFF,
+    0x0B, 0x45, 0x82, 0x1A, 0x0A, 0x43, 0x81, 0x1A, 0x03, 0x82, 0xF5, 0x0A, 0x06, 0x82, 0xFB, 0x05,
+    0x05, 0x82, 0xF1, 0x0E, 0x06, 0x82, 0xF6, 0x09, 0x06, 0x82, 0xFB, 0x04, 0x05, 0x82, 0xF1, 0x0D,
+    0x06, 0x85, 0xF6, 0x08, 0xFF, 0x03, 0x85, 0xFB, 0x03, 0xFF, 0x02, 0x86, 0xF2, 0x0D, 0xF0, 0x0F,
+    0x02, 0x86, 0xF7, 0x07, 0xF0, 0x0F, 0x02, 0x8B, 0xFC, 0x02, 0xF0, 0x0F, 0x20, 0xCF, 0x02, 0x86,
+    0xFF, 0x00, 0xF7, 0x06, 0x02, 0x84, 0xFF, 0x00, 0x0C, 0x52, 0x05, 0x81, 0xFF, 0x07, 0x81, 0xFF,
+    0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x83, 0xFF, 0x00, 0x51, 0x80, 0x03, 0x04, 0x82, 0xFF,
+    0x02, 0x04, 0x82, 0xFF, 0x02, 0x04, 0x82, 0xFF, 0x01, 0x04, 0x82, 0xFF, 0x01, 0x04, 0x81, 0xFF,
+    0x05, 0x45, 0x81, 0x3C, 0x46, 0x80, 0x0D, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF,
+    0x05, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x82, 0xFF, 0x0B, 0x45, 0x82, 0x2B, 0x0B,
+    0x43, 0x81, 0x2B, 0x81, 0xB1, 0x43, 0x82, 0x1A, 0x0A, 0x45, 0x82, 0xFA, 0x0F, 0x03, 0x43, 0x03,
+    0x43, 0x03, 0x43, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x45, 0x81, 0x2B, 0x46, 0x82, 0xFB,
+    0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+    0x82, 0xFF, 0x0A, 0x45, 0x82, 0x1A, 0x0B, 0x43, 0x81, 0x1B, 0x4E, 0x82, 0xFD, 0x0F, 0x02, 0x84,
+    0xF2, 0xFA, 0x0F, 0x02, 0x82, 0xF5, 0x07, 0x04, 0x82, 0xF8, 0x04, 0x04, 0x82, 0xFC, 0x01, 0x04,
+    0x81, 0xCF, 0x04, 0x82, 0xF3, 0x09, 0x04, 0x82, 0xF7, 0x06, 0x04, 0x82, 0xFA, 0x03, 0x04, 0x81,
+    0xFD, 0x04, 0x82, 0xF2, 0x0C, 0x04, 0x82, 0xF5, 0x09, 0x04, 0x82, 0xF8, 0x05, 0x04, 0x82, 0xFC,
+    0x02, 0x04, 0x81, 0xEF, 0x04, 0x82, 0xF3, 0x0B, 0x04, 0x82, 0xF7, 0x08, 0x04, 0x82, 0xFA, 0x05,
+    0x04, 0x82, 0xFD, 0x02, 0x02, 0x81, 0x91, 0x43, 0x82, 0x1A, 0x09, 0x45, 0xBF, 0xE9, 0x1F, 0x00,
+    0xF1, 0xEE, 0x1F, 0x00, 0xF1, 0xEE, 0x1F, 0x00, 0xF1, 0xEE, 0x1F, 0x00, 0xF1, 0xEE, 0x1F, 0x00,
+    0xF1, 0xBE, 0x6F, 0x00, 0xF6, 0x2C, 0xFC, 0x99, 0xCF, 0x02, 0xC0, 0xFF, 0x0C, 0x92, 0x20, 0xFC,
+    0xAA, 0xCF, 0xC2, 0x6F, 0x00, 0xF6, 0xFC, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x03, 0x82, 0xFF, 0x0A, 0x45, 0x82, 0x1A, 0x0A, 0x43, 0x81, 0x1A, 0x81, 0xA1, 0x43,
+    0x82, 0x1A, 0x0A, 0x45, 0x82, 0xFA, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+    0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x82, 0xFF, 0x0D, 0x46, 0x81, 0xD4, 0x45, 0x05, 0x81, 0xFF,
+    0x05, 0x81, 0xFF, 0x05, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x82, 0xFF, 0x0A, 0x45, 0x82, 0x1A,
+    0x0B, 0x43, 0x81, 0x1B, 0x43, 0x0D, 0x43, 0x45, 0x81, 0x2B, 0x46, 0x82, 0xFB, 0x0F, 0x02, 0x84,
+    0xF1, 0xFE, 0x0F, 0x02, 0x84, 0xF1, 0xFE, 0x0F, 0x02, 0x84, 0xF1, 0xFE, 0x0F, 0x02, 0x84, 0xF1,
+    0xFE, 0x0F, 0x02, 0x8A, 0xF1, 0xFE, 0x0F, 0x30, 0xFB, 0x09, 0x44, 0x82, 0x7E, 0x00, 0x44, 0x8C,
+    0x7E, 0xF0, 0x0F, 0x30, 0xFC, 0xFA, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+    0x43, 0x03, 0x43, 0x03, 0x48, 0x80, 0x0C, 0x45, 0x81, 0x2C, 0x82, 0xFF, 0x02, 0x04, 0x80, 0x02,
+    0x43, 0x80, 0x06, 0x04, 0x80, 0x06, 0x43, 0x80, 0x0A, 0x04, 0x80, 0x0A, 0x43, 0x80, 0x0E, 0x04,
+    0x80, 0x0E, 0x44, 0x80, 0x03, 0x02, 0x80, 0x03, 0x45, 0x80, 0x07, 0x02, 0x80, 0x07, 0x43, 0x82,
+    0xEE, 0x0B, 0x02, 0x82, 0xEB, 0x0E, 0x42, 0x86, 0xFA, 0x01, 0xF1, 0x0A, 0x43, 0x86, 0xF6, 0x04,
+    0xF4, 0x06, 0x43, 0x86, 0xF2, 0x08, 0xF8, 0x01, 0x43, 0x86, 0xC0, 0x0C, 0xCC, 0x00, 0x43, 0x86,
+    0x80, 0x2F, 0x8F, 0x00, 0x43, 0x86, 0x40, 0xAF, 0x4F, 0x00, 0x43, 0x86, 0x00, 0xFE, 0x0E, 0x00,
+    0x43, 0x86, 0x00, 0xFA, 0x0A, 0x00, 0x43, 0x86, 0x00, 0xF6, 0x06, 0x00, 0x43, 0x86, 0x00, 0xF2,
+    0x02, 0x00, 0x43, 0x02, 0x80, 0x0A, 0x02, 0x43, 0x06, 0x43, 0x06, 0x81, 0xFF, 0x45, 0x81, 0x2C,
+    0x46, 0x82, 0xFC, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x03, 0x48, 0x80, 0x0C, 0x45, 0x83, 0x2C, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF,
+    0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05,
+    0x81, 0xC2, 0x43, 0x82, 0x2C, 0x0C, 0x45, 0x82, 0xFC, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x84,
+    0xFF, 0xFE, 0x01, 0x02, 0x84, 0xFF, 0xF8, 0x0C, 0x05, 0x82, 0xFC, 0x09, 0x04, 0x83, 0xE2, 0x6F,
+    0x04, 0x83, 0xF4, 0x4F, 0x04, 0x83, 0xF6, 0x2E, 0x04, 0x82, 0xF9, 0x0C, 0x05, 0x82, 0xFC, 0x09,
+    0x04, 0x84, 0xF1, 0xFE, 0x0F, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x82, 0xFF, 0x0C, 0x45,
+    0x82, 0x2C, 0x0C, 0x43, 0x81, 0x2C, 0x4F, 0x02, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF,
+    0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05,
+    0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81,
+    0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x05, 0x81, 0xFF, 0x02, 0x81, 0xC6,
+    0x42, 0x81, 0x4C, 0x45, 0x82, 0xFE, 0x0F, 0x02, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x83, 0xFF,
+    0x91, 0x44, 0x80, 0x09, 0x45, 0x81, 0xFE, 0x02, 0x43, 0x02, 0x43, 0x85, 0x62, 0xF9, 0xDF, 0x45,
+    0x86, 0xE5, 0x9D, 0xF6, 0x0F, 0x81, 0xA1, 0x42, 0x82, 0x2B, 0x0A, 0x44, 0x82, 0xFB, 0x0F, 0x02,
+    0x43, 0x02, 0x43, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x02,
+    0x43, 0x02, 0x82, 0xFF, 0x0B, 0x44, 0x82, 0x2B, 0x0B, 0x42, 0x81, 0x2B, 0x81, 0xC2, 0x42, 0x82,
+    0x2C, 0x0B, 0x44, 0x82, 0xFB, 0x0F, 0x02, 0x43, 0x02, 0x4E, 0x82, 0xFD, 0x0F, 0x04, 0x81, 0xFF,
+    0x04, 0x81, 0xFF, 0x02, 0x43, 0x02, 0x82, 0xFF, 0x0B, 0x44, 0x82, 0x2E, 0x0C, 0x42, 0x81, 0x3B,
+    0x87, 0x91, 0xFE, 0xEF, 0x9E, 0x45, 0x84, 0xFE, 0x04, 0x00, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02,
+    0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x89, 0xFF, 0xFE, 0x04, 0xF0, 0x9F, 0x45, 0x82, 0x91, 0x0E,
+    0x43, 0x04, 0x81, 0xFF, 0x04, 0x83, 0xFF, 0xFE, 0x02, 0x43, 0x02, 0x82, 0xEF, 0x0E, 0x44, 0x82,
+    0x3A, 0x0C, 0x42, 0x81, 0x2B, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF,
+    0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x89, 0xFF, 0x50,
+    0xEB, 0xF7, 0xDF, 0x42, 0x80, 0x0D, 0x42, 0x81, 0x3A, 0x43, 0x82, 0x02, 0x00, 0x43, 0x02, 0x43,
+    0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x8A,
+    0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0x09, 0xAE, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81,
+    0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0xA2, 0xFF, 0x00, 0xF4, 0xFB, 0x0F, 0xD0, 0x2E,
+    0xFF, 0x70, 0x6F, 0xF0, 0x2F, 0xCE, 0x00, 0xFF, 0xFA, 0x02, 0x00, 0x42, 0x80, 0x0A, 0x02, 0xA9,
+    0xFF, 0xEC, 0x01, 0xF0, 0x4F, 0x9F, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xF4, 0x0A, 0xFF, 0x00,
+    0xFB, 0xF3, 0x0F, 0x40, 0xBF, 0x67, 0x97, 0xFF, 0x50, 0xEB, 0x04, 0xB5, 0x7E, 0xFF, 0xFC, 0xFD,
+    0xCC, 0xDF, 0xDF, 0x42, 0x81, 0x18, 0x42, 0x81, 0x18, 0x43, 0x87, 0x03, 0xF0, 0x3F, 0x00, 0x43,
+    0x02, 0x81, 0xFF, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x02, 0x43, 0x02,
+    0x81, 0xFF, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x02, 0x43, 0x02, 0x81,
+    0xFF, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF, 0x86, 0xFF, 0x51, 0xEA, 0x09, 0x45, 0x85,
+    0xFE, 0xEF, 0x39, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43,
+    0x02, 0x43, 0x02, 0x43, 0x02, 0x81, 0xFF, 0x86, 0xFF, 0x82, 0xED, 0x05, 0x45, 0x85, 0xFC, 0xBF,
+    0x27, 0x43, 0x02, 0x43, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF,
+    0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x87, 0xA2, 0xFE, 0xAE, 0xB2, 0x44,
+    0x82, 0xFB, 0x0F, 0x02, 0x43, 0x88, 0x01, 0xF0, 0x9F, 0xEF, 0x04, 0x03, 0x83, 0xF7, 0x8F, 0x03,
+    0x84, 0xD3, 0xBF, 0x02, 0x02, 0x85, 0xB1, 0xCF, 0xFF, 0x02, 0x43, 0x02, 0x82, 0xFF, 0x0B, 0x44,
+    0x82, 0x2B, 0x0A, 0x42, 0x81, 0x2A, 0x82, 0xF0, 0x0F, 0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF, 0x02,
+    0x83, 0xFF, 0x00, 0x49, 0x82, 0xF0, 0x0F, 0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF,
+    0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF, 0x02, 0x81, 0xFF, 0x02, 0x80, 0x0B, 0x42,
+    0x84, 0x20, 0xFB, 0x0F, 0x81, 0xFF, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43,
+    0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x85, 0x31, 0xF5, 0xCF, 0x45, 0x86, 0xE4, 0xCE,
+    0xFA, 0x0F,
+};
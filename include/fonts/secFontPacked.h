@@ -0,0 +1,67 @@
+// Packed by tools/packfont.py from secFont.h, only the glyphs Display.h draws with it; do not edit
+alignas(4) const uint8_t secFontPacked[] PROGMEM = {
+    0x50, 0x56, 0x4C, 0x57, 0x0A, 0x00, 0x21, 0x00, 0x07, 0x00, 0x09, 0x00, 0x30, 0x00, 0x0B, 0x1C,
+    0x0F, 0x02, 0x1C, 0x00, 0x84, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x1C, 0x06, 0x01, 0x1C, 0x00,
+    0xC7, 0x00, 0x00, 0x00, 0x32, 0x00, 0x0A, 0x1C, 0x0E, 0x02, 0x1C, 0x00, 0xF3, 0x00, 0x00, 0x00,
+    0x33, 0x00, 0x0A, 0x1C, 0x0E, 0x02, 0x1C, 0x00, 0x55, 0x01, 0x00, 0x00, 0x34, 0x00, 0x0C, 0x1C,
+    0x0E, 0x01, 0x1C, 0x00, 0xAF, 0x01, 0x00, 0x00, 0x35, 0x00, 0x0A, 0x1C, 0x0E, 0x02, 0x1C, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0x36, 0x00, 0x0A, 0x1C, 0x0E, 0x02, 0x1C, 0x00, 0x89, 0x02, 0x00, 0x00,
+    0x37, 0x00, 0x0A, 0x1C, 0x0A, 0x00, 0x1C, 0x00, 0xD1, 0x02, 0x00, 0x00, 0x38, 0x00, 0x0A, 0x1C,
+    0x0E, 0x02, 0x1C, 0x00, 0x3E, 0x03, 0x00, 0x00, 0x39, 0x00, 0x0A, 0x1C, 0x0E, 0x02, 0x1C, 0x00,
+    0xB0, 0x03, 0x00, 0x00, 0x81, 0xD3, 0x46, 0x82, 0x3D, 0x0D, 0x48, 0x82, 0xFD, 0x0F, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x82, 0xFF, 0x0D,
+    0x48, 0x82, 0x3D, 0x0D, 0x46, 0x81, 0x3D, 0xBF, 0x70, 0x0F, 0xFA, 0xE0, 0x2F, 0xFF, 0xF5, 0x8F,
+    0xFF, 0xFB, 0xEF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x93, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xF0, 0x0F, 0xFF, 0x81, 0xD3, 0x45, 0x82, 0x3D, 0x0C, 0x47, 0x82, 0xFD, 0x0F, 0x05, 0x43, 0x05,
+    0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x06, 0x82, 0xF3,
+    0x0D, 0x06, 0x82, 0xFA, 0x08, 0x05, 0x83, 0xF2, 0x2F, 0x05, 0x82, 0xF9, 0x0B, 0x05, 0x83, 0xF1,
+    0x4F, 0x05, 0x82, 0xF8, 0x0D, 0x05, 0x83, 0xE1, 0x7F, 0x05, 0x83, 0xF6, 0x1E, 0x05, 0x82, 0xFD,
+    0x09, 0x05, 0x83, 0xF5, 0x3F, 0x05, 0x82, 0xFC, 0x0B, 0x05, 0x83, 0xF4, 0x5F, 0x05, 0x82, 0xFB,
+    0x0D, 0x05, 0x83, 0xF3, 0x7F, 0x05, 0x83, 0xF9, 0x1F, 0x04, 0x83, 0xF2, 0xAF, 0x05, 0x83, 0xF8,
+    0x3F, 0x05, 0x80, 0x0E, 0x52, 0x81, 0xC3, 0x45, 0x82, 0x2C, 0x0C, 0x47, 0x82, 0xFC, 0x0F, 0x05,
+    0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x06,
+    0x82, 0xF2, 0x0E, 0x05, 0x83, 0xE4, 0x7F, 0x04, 0x83, 0xF9, 0x5E, 0x03, 0x84, 0xC2, 0x9F, 0x01,
+    0x04, 0x82, 0xFE, 0x06, 0x06, 0x84, 0xD3, 0x9F, 0x01, 0x05, 0x84, 0x91, 0xEF, 0x06, 0x06, 0x83,
+    0xE5, 0x8F, 0x06, 0x82, 0xF2, 0x0E, 0x07, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x82, 0xFF, 0x0D, 0x47, 0x82, 0x3C, 0x0D, 0x45, 0x81, 0x2C, 0x05,
+    0x82, 0xF8, 0x08, 0x08, 0x82, 0xFD, 0x03, 0x07, 0x82, 0xF3, 0x0D, 0x08, 0x82, 0xF8, 0x08, 0x08,
+    0x82, 0xFD, 0x03, 0x07, 0x82, 0xF3, 0x0D, 0x08, 0x82, 0xF8, 0x08, 0x08, 0x82, 0xFD, 0x03, 0x07,
+    0x86, 0xF3, 0x0D, 0xF0, 0x0F, 0x04, 0x86, 0xF8, 0x08, 0xF0, 0x0F, 0x04, 0x86, 0xFD, 0x03, 0xF0,
+    0x0F, 0x03, 0x82, 0xF3, 0x0D, 0x02, 0x81, 0xFF, 0x03, 0x82, 0xF8, 0x08, 0x02, 0x81, 0xFF, 0x03,
+    0x82, 0xFD, 0x03, 0x02, 0x81, 0xFF, 0x02, 0x82, 0xF4, 0x0D, 0x03, 0x81, 0xFF, 0x02, 0x82, 0xF9,
+    0x08, 0x03, 0x81, 0xFF, 0x02, 0x82, 0xFE, 0x03, 0x03, 0x86, 0xFF, 0x00, 0xF4, 0x0D, 0x04, 0x86,
+    0xFF, 0x00, 0xF9, 0x08, 0x04, 0x84, 0xFF, 0x00, 0x0E, 0x56, 0x07, 0x81, 0xFF, 0x09, 0x81, 0xFF,
+    0x09, 0x81, 0xFF, 0x09, 0x81, 0xFF, 0x09, 0x81, 0xFF, 0x09, 0x81, 0xFF, 0x09, 0x83, 0xFF, 0x00,
+    0x80, 0x08, 0x48, 0x80, 0x08, 0x48, 0x82, 0xF9, 0x04, 0x06, 0x82, 0xFA, 0x04, 0x06, 0x82, 0xFA,
+    0x03, 0x06, 0x82, 0xFB, 0x03, 0x06, 0x82, 0xFB, 0x02, 0x06, 0x82, 0xFC, 0x02, 0x06, 0x82, 0xFC,
+    0x01, 0x06, 0x82, 0xFD, 0x01, 0x06, 0x81, 0xFE, 0x07, 0x80, 0x0E, 0x46, 0x81, 0x4D, 0x48, 0x80,
+    0x0D, 0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF,
+    0x07, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x82,
+    0xFF, 0x0D, 0x47, 0x82, 0x4D, 0x0D, 0x45, 0x81, 0x3D, 0x81, 0xD3, 0x45, 0x82, 0x3C, 0x0D, 0x47,
+    0x82, 0xFC, 0x0F, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x07,
+    0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x47, 0x81, 0x4D, 0x48, 0x82, 0xFD, 0x0F,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x82, 0xFF, 0x0D, 0x47, 0x82, 0x3D, 0x0D, 0x45, 0x81,
+    0x3D, 0x52, 0x82, 0xFE, 0x0F, 0x04, 0x84, 0xF1, 0xFC, 0x0F, 0x04, 0x84, 0xF4, 0xF9, 0x0F, 0x04,
+    0x84, 0xF7, 0xF6, 0x0F, 0x04, 0x82, 0xFA, 0x03, 0x06, 0x81, 0xFD, 0x06, 0x82, 0xF1, 0x0D, 0x06,
+    0x82, 0xF4, 0x0A, 0x06, 0x82, 0xF7, 0x07, 0x06, 0x82, 0xFA, 0x04, 0x06, 0x82, 0xFC, 0x01, 0x06,
+    0x81, 0xEF, 0x06, 0x82, 0xF3, 0x0B, 0x06, 0x82, 0xF6, 0x08, 0x06, 0x82, 0xF9, 0x05, 0x06, 0x82,
+    0xFC, 0x02, 0x06, 0x81, 0xEF, 0x06, 0x82, 0xF3, 0x0C, 0x06, 0x82, 0xF6, 0x09, 0x06, 0x82, 0xF8,
+    0x06, 0x06, 0x82, 0xFB, 0x03, 0x06, 0x82, 0xFE, 0x01, 0x05, 0x82, 0xF2, 0x0D, 0x06, 0x82, 0xF5,
+    0x0A, 0x06, 0x82, 0xF8, 0x07, 0x06, 0x82, 0xFB, 0x04, 0x06, 0x82, 0xFE, 0x01, 0x03, 0x81, 0xC2,
+    0x45, 0x82, 0x2C, 0x0B, 0x47, 0x83, 0xEB, 0x1F, 0x03, 0x85, 0xF1, 0xEE, 0x1F, 0x03, 0x85, 0xF1,
+    0xEE, 0x1F, 0x03, 0x85, 0xF1, 0xEE, 0x1F, 0x03, 0x85, 0xF1, 0xEE, 0x1F, 0x03, 0x85, 0xF1, 0xEE,
+    0x1F, 0x03, 0x85, 0xF1, 0xEE, 0x1F, 0x03, 0x85, 0xF1, 0xEE, 0x1F, 0x03, 0x85, 0xF1, 0xCE, 0x4F,
+    0x03, 0x95, 0xF4, 0x6C, 0xFF, 0x08, 0x80, 0xFF, 0x06, 0xE6, 0xDF, 0xFD, 0x6E, 0x02, 0x80, 0x05,
+    0x43, 0x80, 0x05, 0x02, 0x95, 0xE5, 0xDF, 0xFD, 0x5E, 0x70, 0xFF, 0x19, 0x91, 0xFF, 0xD6, 0x4F,
+    0x03, 0x84, 0xF4, 0xFD, 0x0F, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05,
+    0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x82, 0xFF, 0x0C, 0x47, 0x82, 0x3C, 0x0C, 0x45, 0x81, 0x2C,
+    0x81, 0xD3, 0x45, 0x82, 0x2C, 0x0D, 0x47, 0x82, 0xFC, 0x0F, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x82, 0xFF, 0x0E, 0x48, 0x81, 0xE5, 0x47, 0x07, 0x81, 0xFF, 0x07, 0x81, 0xFF, 0x07, 0x81,
+    0xFF, 0x07, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x82, 0xFF,
+    0x0D, 0x47, 0x82, 0x3D, 0x0D, 0x45, 0x81, 0x3D,
+};
@@ -1,1626 +0,0 @@
-//20
-const uint8_t smallFont[] PROGMEM = {0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0D, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x61, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0x13, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC6, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC7, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xD9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDA, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x04, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0xDD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA9, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1D, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00, 0x00, 0x02, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0x39, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3A, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFC, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xAC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 
-0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x11, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1A, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2B, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x22, 0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x60, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x64, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x65, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x25, 0xCA, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x01, 
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0x00, 0x0F, 
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xFF, 0x14, 0x0C, 0xFF, 0xFF, 0x0E, 0x06, 0xFF, 0xFF, 0x08, 
-0x00, 0xFF, 0xFF, 0x02, 0x00, 0xFA, 0xFC, 0x00, 0x00, 0xF4, 0xF6, 0x00, 0x00, 0xEE, 0xF0, 0x00, 
-0x00, 0xE8, 0xEA, 0x00, 0x00, 0xE2, 0xE4, 0x00, 0x00, 0xDC, 0xDE, 0x00, 0x00, 0xD6, 0xD8, 0x00, 
-0x00, 0xCF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xF6, 0xF5, 0x00, 0xF6, 0xF5, 0xE3, 0xE1, 0x00, 0xE3, 0xE2, 0xCF, 0xCD, 0x00, 0xD0, 0xCF, 0xBB, 
-0xB9, 0x00, 0xBD, 0xBC, 0xA6, 0xA5, 0x00, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xE7, 0x00, 
-0x18, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xB7, 0x00, 0x4A, 0xFF, 0xB4, 0x00, 0x00, 0x00, 
-0x79, 0xFF, 0x87, 0x00, 0x7B, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x57, 0x00, 0xAC, 0xFF, 
-0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x41, 0xFF, 0xBE, 0x00, 0x41, 0xFF, 0xBB, 0x00, 0x00, 
-0x00, 0x81, 0xFF, 0x7D, 0x00, 0x81, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3C, 0x00, 0xC0, 
-0xFF, 0x3B, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xA7, 0x00, 0x59, 0xFF, 0xA7, 0x00, 
-0x00, 0x00, 0x86, 0xFF, 0x77, 0x00, 0x89, 0xFF, 0x77, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x47, 0x00, 
-0xB9, 0xFF, 0x47, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0x17, 0x00, 0xE8, 0xFF, 0x17, 0x00, 0x00, 0x00, 
-0x00, 0x8D, 0x80, 0x00, 0x00, 0x44, 0xE8, 0xFF, 0xFF, 0xE8, 0x44, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDC, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 
-0x00, 0xFF, 0xFF, 0xEC, 0xFF, 0xDA, 0x15, 0x00, 0x00, 0x5B, 0xFE, 0xFF, 0xCC, 0x0D, 0x00, 0x00, 
-0x6C, 0xFF, 0xFF, 0xBC, 0x06, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x8B, 0xFF, 
-0xF9, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 
-0x00, 0xFF, 0xFE, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x42, 0xE7, 0xFF, 0xFF, 0xE7, 0x3F, 0x00, 
-0x00, 0x81, 0x80, 0x00, 0x00, 0x51, 0xE1, 0xFF, 0xFE, 0xE1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4E, 
-0xD7, 0x00, 0x00, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x0A, 0xDF, 0x41, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x87, 0xA4, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x29, 0xEA, 0x17, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x5C, 0xCC, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xE1, 0x0F, 
-0xE6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xE2, 0xFF, 0xFF, 0xE2, 0x51, 0x95, 0x95, 0x51, 
-0xE1, 0xFF, 0xFE, 0xE1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xE6, 0x10, 0xE2, 0xFF, 0x00, 
-0x00, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCB, 0x5C, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x16, 0xE9, 0x29, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xA3, 0x87, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x40, 0xDF, 0x0A, 
-0x00, 0x00, 0x00, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0xD6, 0x4E, 0x00, 0x00, 0x00, 
-0x00, 0x51, 0xE2, 0xFF, 0xFF, 0xE2, 0x51, 0x25, 0xC2, 0xFD, 0xFF, 0xFE, 0xC8, 0x2B, 0x00, 0xBD, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0xF2, 0xFF, 0x14, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xF4, 
-0xFF, 0x14, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0xFF, 0x14, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC6, 
-0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x89, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 
-0x8C, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0x65, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF6, 
-0xF5, 0xE3, 0xE1, 0xCF, 0xCD, 0xBB, 0xB9, 0xA6, 0xA5, 0x00, 0x38, 0xFF, 0xD4, 0x00, 0xA8, 0xFF, 
-0x65, 0x0D, 0xF9, 0xF7, 0x0B, 0x54, 0xFF, 0xB5, 0x00, 0x92, 0xFF, 0x72, 0x00, 0xBF, 0xFF, 0x44, 
-0x00, 0xE2, 0xFF, 0x1E, 0x00, 0xF2, 0xFF, 0x0E, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xF2, 0xFF, 0x0E, 
-0x00, 0xE2, 0xFF, 0x1E, 0x00, 0xBF, 0xFF, 0x44, 0x00, 0x92, 0xFF, 0x72, 0x00, 0x54, 0xFF, 0xB5, 
-0x00, 0x0D, 0xF9, 0xF7, 0x0B, 0x00, 0xA8, 0xFF, 0x64, 0x00, 0x38, 0xFF, 0xD3, 0xD4, 0xFF, 0x38, 
-0x00, 0x66, 0xFF, 0xA8, 0x00, 0x0B, 0xF7, 0xF9, 0x0D, 0x00, 0xB6, 0xFF, 0x53, 0x00, 0x72, 0xFF, 
-0x92, 0x00, 0x45, 0xFF, 0xBE, 0x00, 0x1F, 0xFF, 0xE2, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x04, 0xFF, 
-0xFC, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x1E, 0xFF, 0xE2, 0x00, 0x45, 0xFF, 0xBE, 0x00, 0x72, 0xFF, 
-0x92, 0x00, 0xB6, 0xFF, 0x53, 0x0B, 0xF7, 0xF9, 0x0D, 0x65, 0xFF, 0xA8, 0x00, 0xD3, 0xFF, 0x38, 
-0x00, 0x00, 0x00, 0x00, 0xF5, 0xF5, 0x00, 0x00, 0x00, 0x1F, 0xC4, 0x33, 0xDE, 0xE2, 0x31, 0xC4, 
-0x1F, 0x93, 0xFC, 0xF5, 0xEE, 0xF0, 0xF4, 0xFC, 0x93, 0x00, 0x37, 0xE3, 0xFF, 0xFF, 0xE6, 0x39, 
-0x00, 0x92, 0xFC, 0xF4, 0xED, 0xEF, 0xF2, 0xFC, 0x92, 0x20, 0xC5, 0x31, 0xDE, 0xE2, 0x2F, 0xC4, 
-0x1F, 0x00, 0x00, 0x00, 0xF5, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xCC, 0x4D, 0xFF, 0x66, 0x80, 
-0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 
-0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 
-0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x22, 0xFC, 0xE9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x18, 0xF7, 0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0x88, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x0F, 0xF1, 0xF7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x96, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0xE9, 0xFC, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xA5, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xB4, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 
-0xC6, 0xFD, 0xFF, 0xFE, 0xC8, 0x2B, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x01, 0xE1, 0xFF, 0x42, 0xFF, 0xFF, 0xA1, 0xFF, 
-0xFF, 0xF4, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x18, 0xFF, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0x9B, 0x00, 
-0x00, 0x00, 0x2A, 0xFC, 0xFA, 0x22, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x40, 
-0xFF, 0xF7, 0x1B, 0x00, 0x00, 0x01, 0xCB, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xF3, 0x15, 
-0x00, 0x00, 0x07, 0xDF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xEE, 0x0F, 0x00, 0x00, 0x00, 
-0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xC6, 
-0xFD, 0xFF, 0xFE, 0xC8, 0x2B, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xF8, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xBD, 0x00, 0x00, 0x1E, 0xB7, 0xFF, 0xDB, 0x20, 0x00, 
-0x00, 0xE4, 0xFF, 0xFB, 0x2A, 0x00, 0x00, 0x00, 0x16, 0x9E, 0xFE, 0xDF, 0x25, 0x00, 0x00, 0x00, 
-0x00, 0x36, 0xFF, 0xC4, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xA4, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xBC, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFD, 0xE9, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x72, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 
-0x28, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x7D, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xDD, 0xFF, 0x22, 0x00, 0xFF, 0xFF, 0x00, 0x39, 0xFF, 0xC5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x94, 
-0xFF, 0x69, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x2D, 0xCA, 0xFE, 0xFF, 0xFD, 0xC6, 0x2A, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFE, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x24, 0xC0, 0xFE, 0xFF, 0xFE, 0xC9, 
-0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 
-0xFF, 0x00, 0x00, 0x1D, 0xFF, 0xC5, 0xFF, 0xFF, 0x00, 0x00, 0x59, 0xFF, 0x8C, 0x00, 0x00, 0x00, 
-0x00, 0x94, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x0D, 0xFC, 
-0xE2, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0xBB, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x06, 0x00, 0x00, 0x00, 
-0x31, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 
-0x54, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x1C, 0x00, 0x00, 0x29, 0xC5, 0xFD, 0xFF, 0xFE, 0xC7, 
-0x2B, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x08, 0x00, 0x08, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x08, 0x00, 0x08, 0xFF, 0xFF, 0xFC, 0xFF, 0x08, 0x00, 0x08, 0xFF, 0xFC, 0xDC, 0xFF, 0x1A, 
-0x00, 0x1A, 0xFF, 0xDC, 0x67, 0xFF, 0xED, 0x8E, 0xEE, 0xFF, 0x67, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 
-0xC5, 0x00, 0x6D, 0xFF, 0xD6, 0x75, 0xD6, 0xFF, 0x6A, 0xE0, 0xFF, 0x02, 0x00, 0x03, 0xFF, 0xDE, 
-0xFD, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 
-0xFE, 0xC9, 0x2C, 0x2F, 0xCE, 0xFF, 0xFF, 0xFE, 0xC7, 0x2B, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xCF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x20, 0xFF, 0xBF, 0x61, 0xFF, 0x3F, 0xA1, 0xBF, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x15, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xEA, 0xFF, 0x00, 0x15, 0xAA, 0xFF, 0xE3, 
-0x50, 0x55, 0xEA, 0xFC, 0x91, 0x0C, 0x00, 0xFF, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x57, 0xED, 0xFC, 
-0x8F, 0x0C, 0x00, 0x00, 0x18, 0xB3, 0xFF, 0xE2, 0x4F, 0x00, 0x00, 0x00, 0x62, 0xF1, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x1F, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 
-0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x63, 0x00, 0x00, 0x00, 0x50, 0xE3, 0xFF, 0xB3, 0x18, 
-0x00, 0x00, 0x0D, 0x91, 0xFC, 0xEC, 0x57, 0x00, 0x00, 0x00, 0x66, 0xFF, 0xFF, 0x00, 0x0C, 0x8F, 
-0xFC, 0xED, 0x57, 0x4F, 0xE3, 0xFF, 0xB4, 0x18, 0x00, 0xFF, 0xF2, 0x64, 0x00, 0x00, 0x00, 0xBF, 
-0x1F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xBF, 0x00, 0x00, 0x48, 0xFC, 0xEB, 0x20, 0x00, 
-0x29, 0xF1, 0xFB, 0x40, 0x00, 0x00, 0xC8, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2C, 
-0xC8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 
-0x20, 0xBF, 0xFB, 0xDB, 0x3C, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xB1, 0xFF, 0x08, 0xFF, 0xD0, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xE6, 0xFF, 0x08, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xC9, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xC9, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xC7, 0xFF, 0x00, 0x00, 
-0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x4D, 
-0xFF, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0xB4, 
-0xF7, 0xF7, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 0x00, 0x00, 0x1A, 0xFF, 
-0x9E, 0xA0, 0xFF, 0x2D, 0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 0x00, 0x00, 0x81, 0xFF, 
-0x42, 0x46, 0xFF, 0x8F, 0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0xE7, 0xE6, 
-0x00, 0x00, 0xEA, 0xF0, 0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x4E, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 0x84, 0xB5, 0xFF, 0x3D, 
-0x00, 0x00, 0x3E, 0xFF, 0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFD, 0xC2, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0xFF, 0xFF, 0x00, 0x00, 0x14, 
-0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0xFF, 0xDE, 
-0xFF, 0xFF, 0x00, 0x02, 0x73, 0xFF, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x14, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xDC, 0x13, 0xFF, 0xFF, 0x00, 0x01, 0x6A, 0xFF, 0xA0, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x2C, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE4, 0x76, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0x00, 
-0x01, 0x4C, 0xFF, 0xE4, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x4F, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x79, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2A, 0xC6, 
-0xFD, 0xFF, 0xFE, 0xC8, 0x2B, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0xFF, 0xFF, 0x00, 0x00, 0x3A, 0xFF, 0xC5, 0xFF, 0xFF, 
-0x00, 0x00, 0xAF, 0xFE, 0x34, 0xFF, 0xFF, 0x00, 0x24, 0xFD, 0x9F, 0x00, 0xFF, 0xFF, 0x00, 0x97, 
-0xF3, 0x19, 0x00, 0xFF, 0xFF, 0x14, 0xF6, 0x79, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xDE, 0x07, 0x00, 
-0x00, 0xFF, 0xFF, 0xEA, 0x52, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xF7, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x95, 0xDB, 0x06, 0x00, 0x00, 0xFF, 0xFF, 0x21, 
-0xFC, 0x72, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA5, 0xEF, 0x14, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 
-0x94, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xB5, 0xFB, 0x29, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0xFF, 0xB7, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x03, 0x00, 0x00, 
-0x00, 0x03, 0xE8, 0xFF, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 
-0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x04, 0x00, 0x04, 0xEC, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x47, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9E, 0x00, 0x9F, 0xFF, 0xFE, 
-0xFF, 0xFF, 0xF3, 0xE6, 0xEF, 0x0C, 0xEF, 0xE9, 0xF3, 0xFF, 0xFF, 0xFF, 0xA0, 0xFF, 0x99, 0xFF, 
-0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xFF, 0xF9, 0xFF, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xFD, 
-0xFF, 0xFE, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xCA, 0xFF, 0xCD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x83, 0xFF, 0x86, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xEE, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x69, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xC6, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xCF, 0xFF, 
-0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xFD, 0xDD, 0xF8, 
-0xFF, 0xFF, 0xFF, 0x00, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x0F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xEE, 0xFF, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 
-0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 
-0xFF, 0xFE, 0xC9, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x2C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xC6, 0xFD, 
-0xFF, 0xFE, 0xC8, 0x2B, 0x00, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0xFE, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 
-0x00, 0x02, 0xFF, 0xFF, 0x6C, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC9, 0xFE, 
-0xFF, 0xFF, 0xEC, 0x7D, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD0, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xDB, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0xF8, 0x79, 0x00, 0xFF, 0xFF, 0x00, 0xED, 0xFF, 0x52, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xA4, 0xFF, 0x99, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x58, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x10, 0xFB, 0xFF, 0x27, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x6E, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x73, 0xFF, 0xB5, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x26, 0xFF, 0xF5, 0x07, 0x3D, 0xD0, 0xFE, 
-0xFF, 0xFE, 0xD0, 0x3D, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x21, 0x00, 0x00, 0xFF, 0xFF, 
-0x8C, 0xFF, 0xE2, 0x24, 0x00, 0x00, 0x00, 0x01, 0x95, 0xFF, 0xE6, 0x29, 0x00, 0x00, 0x00, 0x00, 
-0x8F, 0xFF, 0xE9, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xED, 0x32, 0x00, 0x00, 0x00, 0x00, 
-0x83, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x3D, 
-0xD1, 0xFE, 0xFF, 0xFE, 0xD1, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0xE6, 0xFF, 0x15, 0x00, 0x00, 0x15, 0xFF, 0xE5, 0xB3, 
-0xFF, 0x3F, 0x00, 0x00, 0x40, 0xFF, 0xB2, 0x80, 0xFF, 0x69, 0x00, 0x00, 0x6A, 0xFF, 0x7F, 0x4D, 
-0xFF, 0x93, 0x00, 0x00, 0x94, 0xFF, 0x4C, 0x1A, 0xFF, 0xBD, 0x00, 0x00, 0xBE, 0xFF, 0x19, 0x00, 
-0xE6, 0xE7, 0x00, 0x00, 0xE8, 0xE5, 0x00, 0x00, 0xB3, 0xFF, 0x11, 0x11, 0xFF, 0xB2, 0x00, 0x00, 
-0x80, 0xFF, 0x3B, 0x3C, 0xFF, 0x7F, 0x00, 0x00, 0x4D, 0xFF, 0x65, 0x66, 0xFF, 0x4C, 0x00, 0x00, 
-0x1A, 0xFF, 0x8F, 0x90, 0xFF, 0x19, 0x00, 0x00, 0x00, 0xE6, 0xC8, 0xC5, 0xE5, 0x00, 0x00, 0x00, 
-0x00, 0xB3, 0xFA, 0xFB, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0xEF, 
-0xFF, 0x09, 0x09, 0xFF, 0xFF, 0x09, 0x09, 0xFF, 0xEE, 0xCD, 0xFF, 0x1B, 0x1C, 0xFF, 0xFF, 0x1B, 
-0x1C, 0xFF, 0xCC, 0xAB, 0xFF, 0x2D, 0x2E, 0xFF, 0xFF, 0x2D, 0x2E, 0xFF, 0xAA, 0x89, 0xFF, 0x40, 
-0x41, 0xFF, 0xFF, 0x40, 0x41, 0xFF, 0x88, 0x67, 0xFF, 0x52, 0x53, 0xFF, 0xFF, 0x52, 0x53, 0xFF, 
-0x66, 0x45, 0xFF, 0x65, 0x66, 0xFC, 0xFA, 0x65, 0x66, 0xFF, 0x44, 0x23, 0xFF, 0x77, 0x78, 0xEF, 
-0xEF, 0x77, 0x78, 0xFF, 0x22, 0x04, 0xFB, 0x8A, 0x8B, 0xD4, 0xD5, 0x8A, 0x8B, 0xFB, 0x04, 0x00, 
-0xDE, 0x9C, 0x9D, 0xB8, 0xB9, 0x9C, 0x9D, 0xDD, 0x00, 0x00, 0xBC, 0xB7, 0xB5, 0x9B, 0x9C, 0xB6, 
-0xB5, 0xBB, 0x00, 0x00, 0x9A, 0xF1, 0xED, 0x7F, 0x80, 0xF0, 0xED, 0x99, 0x00, 0x00, 0x78, 0xFF, 
-0xFF, 0x63, 0x64, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0x46, 0x47, 0xFF, 0xFF, 0x55, 
-0x00, 0x00, 0x34, 0xFF, 0xFF, 0x2A, 0x2B, 0xFF, 0xFF, 0x33, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0x0E, 
-0x0E, 0xFF, 0xFF, 0x11, 0x00, 0xD7, 0xFF, 0x27, 0x00, 0x26, 0xFF, 0xDC, 0x82, 0xFF, 0x76, 0x00, 
-0x75, 0xFF, 0x87, 0x2E, 0xFF, 0xC6, 0x00, 0xC3, 0xFF, 0x31, 0x00, 0xD9, 0xFD, 0x2A, 0xFC, 0xDB, 
-0x00, 0x00, 0x85, 0xFF, 0xC1, 0xFF, 0x85, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 
-0x00, 0xDB, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xEE, 
-0xFF, 0xF2, 0x07, 0x00, 0x00, 0x46, 0xFF, 0xFA, 0xFF, 0x49, 0x00, 0x00, 0x97, 0xFF, 0x8E, 0xFF, 
-0x99, 0x00, 0x01, 0xE6, 0xF6, 0x10, 0xF6, 0xE7, 0x01, 0x3B, 0xFF, 0xB5, 0x00, 0xB6, 0xFF, 0x38, 
-0x8C, 0xFF, 0x6C, 0x00, 0x6D, 0xFF, 0x88, 0xDD, 0xFF, 0x24, 0x00, 0x24, 0xFF, 0xD8, 0xDE, 0xFF, 
-0x27, 0x00, 0x00, 0x27, 0xFF, 0xDD, 0x8D, 0xFF, 0x77, 0x00, 0x00, 0x76, 0xFF, 0x8B, 0x3C, 0xFF, 
-0xC7, 0x00, 0x00, 0xC5, 0xFF, 0x39, 0x02, 0xE7, 0xFE, 0x19, 0x16, 0xFD, 0xE6, 0x01, 0x00, 0x98, 
-0xFF, 0x67, 0x62, 0xFF, 0x96, 0x00, 0x00, 0x47, 0xFF, 0xB7, 0xB1, 0xFF, 0x44, 0x00, 0x00, 0x05, 
-0xEE, 0xF9, 0xF6, 0xEB, 0x04, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 
-0x49, 0xFF, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0xA3, 
-0xF7, 0x13, 0x00, 0x00, 0x00, 0x15, 0xF8, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0x31, 0x00, 
-0x00, 0x00, 0x03, 0xE2, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 
-0xBF, 0xE5, 0x04, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x97, 0xF9, 0x16, 
-0x00, 0x00, 0x00, 0x0E, 0xF3, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x36, 0x00, 0x00, 0x00, 
-0x00, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 
-0xE1, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0x51, 
-0xE2, 0xFF, 0xFF, 0xD5, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-0x00, 0x2B, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 
-0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xD5, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x2A, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xD5, 0xFF, 0xFE, 0xE1, 0x50, 
-0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE2, 0x51, 
-0x00, 0x00, 0x4E, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0xFF, 0xDD, 0x08, 0x00, 0x00, 0x89, 
-0xFF, 0xBE, 0xFF, 0x7F, 0x00, 0x2B, 0xFA, 0xC5, 0x03, 0xC7, 0xF7, 0x21, 0xC2, 0xFA, 0x2B, 0x00, 
-0x2D, 0xFB, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xBE, 0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x20, 0xEB, 0xC8, 0x2C, 
-0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xD3, 0xE4, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 
-0xFF, 0xFF, 0xED, 0xB0, 0x1C, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 
-0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 
-0x2C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x34, 
-0xCF, 0xFB, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x20, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x71, 0xFF, 0xFF, 0xE7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xE0, 0xE4, 0x7B, 0xFF, 0xFF, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 
-0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0x00, 0x2C, 0xC8, 0xFE, 0x00, 0xC9, 0xFF, 0xFF, 0x00, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x44, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x1E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 
-0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x34, 0xD3, 0xD0, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDB, 0xFF, 0xFF, 0x90, 0x30, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04, 0xFF, 0xFF, 0x04, 0x04, 0xFF, 0xFF, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC4, 0x00, 0xFE, 0xC0, 0x24, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x44, 0xFF, 0xCA, 0xFF, 0xFF, 0x01, 0xCC, 0xFF, 0x57, 0xFF, 0xFF, 0x57, 0xFF, 0xE0, 
-0x04, 0xFF, 0xFF, 0xDB, 0xFF, 0x72, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0xFF, 0xFF, 0xE7, 
-0xFF, 0x5C, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xB9, 0x00, 0xFF, 0xFF, 0x18, 0xFA, 0xFC, 0x19, 0xFF, 
-0xFF, 0x00, 0xA5, 0xFF, 0x73, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xC7, 0xE5, 0x3E, 0x23, 
-0xC8, 0xE1, 0x46, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDA, 0xEC, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xA8, 
-0x38, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 
-0xDE, 0xE1, 0x50, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0x50, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x3D, 0xD5, 0xFE, 0xFE, 0xD5, 0x3C, 0xD6, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x3D, 
-0xD6, 0xFE, 0xFE, 0xD6, 0x3D, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xFA, 0xF6, 0xC1, 
-0x27, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x50, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 
-0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 
-0xE0, 0xC8, 0x2B, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xC8, 0xFF, 0xFF, 0xA8, 0x38, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xC7, 0xFE, 0xFE, 0xC7, 0x2B, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x34, 0x00, 0x00, 
-0x00, 0x66, 0xE6, 0xFD, 0x93, 0x0F, 0x00, 0x00, 0x0E, 0x94, 0xFD, 0xE6, 0x67, 0x00, 0x00, 0x00, 
-0x34, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 
-0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 
-0xFF, 0x00, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC9, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xE6, 0xFF, 0x11, 0x11, 0xFF, 0xE5, 0xB3, 0xFF, 0x35, 0x36, 0xFF, 0xB2, 0x80, 0xFF, 
-0x59, 0x5A, 0xFF, 0x7F, 0x4D, 0xFF, 0x7D, 0x7E, 0xFF, 0x4C, 0x1A, 0xFF, 0xA1, 0xA2, 0xFF, 0x19, 
-0x00, 0xE6, 0xC5, 0xC6, 0xE5, 0x00, 0x00, 0xB3, 0xE9, 0xEA, 0xB2, 0x00, 0x00, 0x80, 0xFF, 0xFF, 
-0x7F, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x19, 0x00, 0xE5, 0xFF, 
-0x11, 0x11, 0xFF, 0xFF, 0x11, 0x11, 0xFF, 0xE4, 0xAF, 0xFF, 0x33, 0x34, 0xFF, 0xFF, 0x33, 0x34, 
-0xFF, 0xAE, 0x78, 0xFF, 0x55, 0x56, 0xFF, 0xFF, 0x55, 0x56, 0xFF, 0x77, 0x42, 0xFF, 0x77, 0x78, 
-0xFF, 0xFF, 0x77, 0x78, 0xFF, 0x41, 0x0D, 0xFD, 0x99, 0x9A, 0xE6, 0xEE, 0x99, 0x9A, 0xFD, 0x0D, 
-0x00, 0xD5, 0xBB, 0xBC, 0xBC, 0xC3, 0xBB, 0xBC, 0xD4, 0x00, 0x00, 0x9F, 0xDD, 0xDE, 0x92, 0x98, 
-0xDD, 0xDE, 0x9E, 0x00, 0x00, 0x68, 0xFB, 0xFB, 0x68, 0x6D, 0xFB, 0xFB, 0x67, 0x00, 0x00, 0x32, 
-0xFF, 0xFF, 0x3E, 0x41, 0xFF, 0xFF, 0x31, 0x00, 0x00, 0x04, 0xF6, 0xFF, 0x14, 0x16, 0xFF, 0xF6, 
-0x04, 0x00, 0xC9, 0xFF, 0x3E, 0x00, 0x3E, 0xFF, 0xCD, 0x5B, 0xFF, 0xBA, 0x00, 0xBB, 0xFF, 0x5D, 
-0x05, 0xE6, 0xFF, 0x6C, 0xFF, 0xE7, 0x06, 0x00, 0x7E, 0xFF, 0xFE, 0xFF, 0x7E, 0x00, 0x00, 0x16, 
-0xF8, 0xFF, 0xF8, 0x16, 0x00, 0x00, 0x16, 0xF8, 0xFF, 0xF8, 0x16, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
-0xFF, 0x7D, 0x00, 0x06, 0xE7, 0xFF, 0x7D, 0xFF, 0xE6, 0x05, 0x5D, 0xFF, 0xBE, 0x00, 0xBF, 0xFF, 
-0x5A, 0xCC, 0xFF, 0x3F, 0x00, 0x40, 0xFF, 0xC8, 0xE6, 0xFF, 0x11, 0x11, 0xFF, 0xE5, 0xB3, 0xFF, 
-0x34, 0x35, 0xFF, 0xB2, 0x80, 0xFF, 0x57, 0x58, 0xFF, 0x7F, 0x4D, 0xFF, 0x7B, 0x7C, 0xFF, 0x4B, 
-0x1A, 0xFF, 0x9E, 0x9F, 0xFF, 0x18, 0x00, 0xE6, 0xC1, 0xC2, 0xE4, 0x00, 0x00, 0xB3, 0xE5, 0xE6, 
-0xB1, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0x7D, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x1A, 
-0xFF, 0xFF, 0x17, 0x00, 0x00, 0x20, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9D, 0x00, 0x00, 
-0x00, 0xA1, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x07, 0xE2, 0xFF, 0x7B, 0x00, 0x00, 
-0x6E, 0xFF, 0xEA, 0x0C, 0x00, 0x0A, 0xE7, 0xFF, 0x72, 0x00, 0x00, 0x75, 0xFF, 0xE5, 0x08, 0x00, 
-0x0D, 0xEB, 0xFF, 0x6A, 0x00, 0x00, 0x7D, 0xFF, 0xE0, 0x06, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1E, 0xC2, 0xFE, 0xFF, 0x00, 0x00, 
-0xAE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF2, 0xFF, 0x32, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x4A, 0xFF, 0xED, 0x00, 0x00, 0x41, 0xF7, 0xF2, 0x4A, 0x00, 0x00, 0xE6, 0xFF, 
-0x53, 0x00, 0x00, 0x00, 0x37, 0xF0, 0xF5, 0x59, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xF5, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x30, 0x03, 0x00, 0x00, 
-0xB8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x23, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFE, 0xC2, 0x1E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x03, 0x32, 0xFF, 0xF2, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xFF, 0x4A, 0x00, 
-0x00, 0x00, 0x4D, 0xF3, 0xF7, 0x41, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xE5, 0x00, 0x00, 0x5D, 0xF6, 
-0xEF, 0x37, 0x00, 0x00, 0xF6, 0xFF, 0x32, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x03, 0x31, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0xFF, 0xFE, 0xC6, 0x23, 
-0x00, 0x00, 0xB6, 0xF1, 0xA2, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xB4, 0x3C, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xB6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xA4, 
-0xF2, 0xB5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xD0, 0xD2, 0x00, 0x00, 0xD6, 0xD8, 0x00, 0x00, 0xDC, 0xDE, 0x00, 0x00, 0xE2, 0xE4, 0x00, 0x00, 
-0xE8, 0xEA, 0x00, 0x00, 0xEE, 0xF0, 0x00, 0x00, 0xF4, 0xF6, 0x00, 0x00, 0xFA, 0xFC, 0x00, 0x00, 
-0xFE, 0xFF, 0x02, 0x06, 0xFF, 0xFF, 0x08, 0x0C, 0xFF, 0xFF, 0x0E, 0x11, 0xFF, 0xFF, 0x14, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x38, 0xC8, 0xFF, 0xC9, 0x38, 0xDB, 0xFF, 
-0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 
-0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE0, 0x47, 0xDA, 0xFF, 0xDB, 0x48, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFD, 0xBE, 
-0x24, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x1F, 0xC2, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xC2, 0x1F, 0xA4, 0xFF, 
-0xEE, 0x3B, 0x00, 0x00, 0x00, 0x39, 0xED, 0xFF, 0xA3, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 
-0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 
-0xA3, 0xFF, 0xED, 0x39, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0xFF, 0xA2, 0x20, 0xC3, 0x29, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2B, 0xC3, 0x1F, 0xD9, 0xFF, 0x26, 0x00, 0x00, 0x26, 0xFF, 0xDB, 0x85, 0xFF, 
-0x72, 0x00, 0x00, 0x73, 0xFF, 0x85, 0x31, 0xFF, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x2F, 0x00, 0xDC, 
-0xFB, 0x0F, 0x10, 0xFB, 0xD9, 0x00, 0x00, 0x87, 0xFF, 0x57, 0x58, 0xFF, 0x83, 0x00, 0xFF, 0xFF, 
-0xFF, 0xA3, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xED, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x9F, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x51, 0xE1, 0xFF, 0xFF, 0xFE, 0xE1, 0x50, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xCB, 
-0x61, 0x09, 0x00, 0x00, 0x3C, 0xD0, 0xFF, 0xFF, 0xEE, 0x8E, 0x1D, 0x9F, 0xFB, 0xF2, 0xA8, 0xED, 
-0xFF, 0xE0, 0xFF, 0xFF, 0x18, 0x00, 0x18, 0xFF, 0xFF, 0xEE, 0xFF, 0xED, 0xA7, 0xF2, 0xFD, 0xAF, 
-0x1D, 0x8B, 0xEC, 0xFF, 0xFF, 0xD2, 0x3C, 0x00, 0x00, 0x08, 0x60, 0xCB, 0xFF, 0xED, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE1, 0x51, 0xE2, 0xFF, 0xFF, 0xFF, 0xE2, 0x51, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x2C, 0xC8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 
-0xC9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xE1, 
-0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC9, 0xFF, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC9, 
-0xFF, 0x00, 0x00, 0xFF, 0xC8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 
-0x2C, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xC9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x2C, 0x41, 0xDA, 0xFD, 0xFE, 0xC8, 0x2B, 0xCD, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x4F, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x01, 0x05, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x2C, 0xC9, 0xF2, 0xC8, 0xF4, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x72, 0xFF, 0x9D, 0x72, 
-0xFF, 0x9D, 0x00, 0x5A, 0xFE, 0xBA, 0x5E, 0xFE, 0xBA, 0x04, 0x44, 0xFA, 0xD1, 0x52, 0xFA, 0xD1, 
-0x0E, 0x00, 0xE5, 0xFF, 0x37, 0xE5, 0xFF, 0x37, 0x00, 0x00, 0x44, 0xFA, 0xCE, 0x50, 0xFA, 0xCE, 
-0x0C, 0x00, 0x00, 0x5A, 0xFE, 0xB3, 0x5D, 0xFE, 0xB3, 0x02, 0x00, 0x00, 0x73, 0xFF, 0x92, 0x73, 
-0xFF, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC8, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE8, 0xFF, 0xF5, 0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xB8, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x3A, 0xFF, 0xBF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xBD, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x2C, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xFB, 0xFF, 0xFB, 0x53, 0xFB, 
-0xFF, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFA, 0xFF, 
-0x00, 0xFF, 0xFA, 0x53, 0xFB, 0xFF, 0xFB, 0x52, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0xAF, 0xFF, 
-0x9C, 0x01, 0x43, 0xFF, 0xA0, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 
-0x58, 0x11, 0x86, 0xFF, 0xFF, 0xDC, 0xEB, 0x78, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x51, 0xE1, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x39, 0x00, 0x00, 0x00, 
-0xB6, 0xFF, 0xBE, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xBF, 0x2C, 0xC8, 0xFE, 
-0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 
-0xFF, 0x72, 0x92, 0xFF, 0x72, 0x00, 0x00, 0x03, 0xB4, 0xFE, 0x5C, 0xB4, 0xFE, 0x59, 0x00, 0x00, 
-0x0C, 0xCF, 0xF9, 0x50, 0xCF, 0xF9, 0x44, 0x00, 0x00, 0x37, 0xFF, 0xE4, 0x37, 0xFF, 0xE4, 0x00, 
-0x0E, 0xD1, 0xF9, 0x52, 0xD1, 0xF9, 0x44, 0x04, 0xBA, 0xFE, 0x5E, 0xBA, 0xFE, 0x5A, 0x00, 0x9E, 
-0xFF, 0x72, 0x9E, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 
-0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xF5, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xC4, 
-0x00, 0x00, 0x45, 0xFB, 0xF0, 0x29, 0x00, 0x28, 0xF0, 0xFC, 0x48, 0x00, 0x00, 0xC8, 0xFF, 0x70, 
-0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 
-0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 
-0x2C, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x69, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF7, 0xF7, 0xCB, 0x00, 
-0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 0x00, 0x00, 0x1A, 0xFF, 0x9E, 0xA0, 0xFF, 0x2D, 
-0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 0x00, 0x00, 0x81, 0xFF, 0x42, 0x46, 0xFF, 0x8F, 
-0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0xE7, 0xE6, 0x00, 0x00, 0xEA, 0xF0, 
-0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 0x84, 0xB5, 0xFF, 0x3D, 0x00, 0x00, 0x3E, 0xFF, 
-0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x22, 0xF8, 0xFF, 0x98, 
-0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xA0, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 
-0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 
-0x00, 0x00, 0x00, 0xB4, 0xF7, 0xF7, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 
-0x00, 0x00, 0x1A, 0xFF, 0x9E, 0xA0, 0xFF, 0x2D, 0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 
-0x00, 0x00, 0x81, 0xFF, 0x42, 0x46, 0xFF, 0x8F, 0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 
-0x00, 0x00, 0xE7, 0xE6, 0x00, 0x00, 0xEA, 0xF0, 0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x22, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 
-0x84, 0xB5, 0xFF, 0x3D, 0x00, 0x00, 0x3E, 0xFF, 0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 
-0xE7, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 
-0x00, 0x00, 0x00, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x69, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF7, 0xF7, 0xCB, 0x00, 
-0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 0x00, 0x00, 0x1A, 0xFF, 0x9E, 0xA0, 0xFF, 0x2D, 
-0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 0x00, 0x00, 0x81, 0xFF, 0x42, 0x46, 0xFF, 0x8F, 
-0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0xE7, 0xE6, 0x00, 0x00, 0xEA, 0xF0, 
-0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 0x84, 0xB5, 0xFF, 0x3D, 0x00, 0x00, 0x3E, 0xFF, 
-0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE7, 0x00, 0x00, 0x66, 0xE0, 0xF1, 0xB8, 0x4A, 
-0xE4, 0x00, 0x00, 0xEC, 0x21, 0xAF, 0xF0, 0xEB, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x69, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF7, 0xF7, 0xCB, 0x00, 
-0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 0x00, 0x00, 0x1A, 0xFF, 0x9E, 0xA0, 0xFF, 0x2D, 
-0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 0x00, 0x00, 0x81, 0xFF, 0x42, 0x46, 0xFF, 0x8F, 
-0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0xE7, 0xE6, 0x00, 0x00, 0xEA, 0xF0, 
-0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 0x84, 0xB5, 0xFF, 0x3D, 0x00, 0x00, 0x3E, 0xFF, 
-0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x69, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF7, 0xF7, 0xCB, 0x00, 
-0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 0x00, 0x00, 0x1A, 0xFF, 0x9E, 0xA0, 0xFF, 0x2D, 
-0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 0x00, 0x00, 0x81, 0xFF, 0x42, 0x46, 0xFF, 0x8F, 
-0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0xE7, 0xE6, 0x00, 0x00, 0xEA, 0xF0, 
-0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 0x84, 0xB5, 0xFF, 0x3D, 0x00, 0x00, 0x3E, 0xFF, 
-0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 0xE7, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0xFF, 0x77, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xFF, 0xFF, 0x78, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x38, 0x00, 
-0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x9A, 0x00, 
-0x00, 0x00, 0x00, 0xB4, 0xF7, 0xF7, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xCC, 0xCE, 0xF8, 0x04, 
-0x00, 0x00, 0x1A, 0xFF, 0x9E, 0xA0, 0xFF, 0x2D, 0x00, 0x00, 0x4E, 0xFF, 0x70, 0x73, 0xFF, 0x5E, 
-0x00, 0x00, 0x81, 0xFF, 0x42, 0x46, 0xFF, 0x8F, 0x00, 0x00, 0xB4, 0xFF, 0x14, 0x18, 0xFF, 0xC0, 
-0x00, 0x00, 0xE7, 0xE6, 0x00, 0x00, 0xEA, 0xF0, 0x01, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x22, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x81, 0xFF, 0x66, 0x00, 0x00, 0x68, 0xFF, 
-0x84, 0xB5, 0xFF, 0x3D, 0x00, 0x00, 0x3E, 0xFF, 0xB5, 0xE8, 0xFF, 0x14, 0x00, 0x00, 0x15, 0xFF, 
-0xE7, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0xEF, 0xDB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFF, 0x9A, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0x59, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-0xFF, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xF8, 0xD6, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x48, 0xFF, 0x95, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0x54, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x15, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x9C, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x9C, 0xFF, 0x5D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x1F, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 
-0x00, 0x00, 0x00, 0xFE, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0xBE, 0x00, 0x00, 0xFF, 
-0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 
-0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x22, 0xF8, 0xFF, 
-0x98, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x43, 0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8E, 0xFF, 
-0x93, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xBE, 0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x20, 
-0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x43, 0xFF, 0xA0, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x8E, 0xFF, 0x93, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x66, 0xE0, 0xF1, 0xB8, 0x4A, 
-0xE4, 0x00, 0xEC, 0x21, 0xAF, 0xF0, 0xEB, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xEE, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xC6, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xCF, 0xFF, 0x24, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x74, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xFD, 0xDD, 0xF8, 0xFF, 0xFF, 0xFF, 
-0x00, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 
-0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x51, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xEE, 0xFF, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 
-0xD0, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 0x00, 
-0x22, 0xF8, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x43, 0xFF, 0xA0, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 0xC8, 0x2B, 
-0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 
-0xC9, 0x2C, 0x00, 0x00, 0x8E, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0x00, 
-0x00, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 
-0xFE, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0x66, 0xE0, 0xF1, 0xB8, 0x4A, 0xE4, 0x00, 0xEC, 
-0x21, 0xAF, 0xF0, 0xEB, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 
-0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 
-0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 0xFE, 0xC8, 
-0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 
-0xFE, 0xC9, 0x2C, 0x1F, 0xBC, 0x17, 0x00, 0x15, 0xBB, 0x20, 0xBC, 0xFF, 0xCD, 0x19, 0xCB, 0xFF, 
-0xBC, 0x17, 0xCD, 0xFF, 0xF4, 0xFF, 0xCC, 0x16, 0x00, 0x1A, 0xF4, 0xFF, 0xF4, 0x1A, 0x00, 0x16, 
-0xCD, 0xFF, 0xF3, 0xFF, 0xCD, 0x17, 0xBD, 0xFF, 0xCB, 0x18, 0xCC, 0xFF, 0xBC, 0x20, 0xBC, 0x16, 
-0x00, 0x16, 0xBC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x39, 
-0xFF, 0xB4, 0x2C, 0xC8, 0xFE, 0xFF, 0xFF, 0xFF, 0xAF, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 
-0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xF1, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC8, 0xB6, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x2C, 0xB5, 0xFF, 0x3B, 0x00, 0x00, 
-0x00, 0x00, 0xEC, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 
-0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 
-0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 
-0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x43, 0xFF, 
-0xA0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 
-0xFE, 0xC9, 0x2C, 0x00, 0x00, 0x8E, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 
-0x00, 0x00, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 
-0xC9, 0xFE, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0x00, 
-0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xFF, 0x27, 0x00, 0x00, 0x27, 0xFF, 0xDD, 0x8D, 0xFF, 
-0x77, 0x00, 0x00, 0x76, 0xFF, 0x8B, 0x3C, 0xFF, 0xC7, 0x00, 0x00, 0xC5, 0xFF, 0x39, 0x02, 0xE7, 
-0xFE, 0x19, 0x16, 0xFD, 0xE6, 0x01, 0x00, 0x98, 0xFF, 0x67, 0x62, 0xFF, 0x96, 0x00, 0x00, 0x47, 
-0xFF, 0xB7, 0xB1, 0xFF, 0x44, 0x00, 0x00, 0x05, 0xEE, 0xF9, 0xF6, 0xEB, 0x04, 0x00, 0x00, 0x00, 
-0x99, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD4, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xFA, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 
-0xFF, 0xF7, 0xFF, 0xFF, 0x05, 0xAC, 0xFF, 0x94, 0xFF, 0xFF, 0x54, 0xFF, 0xD4, 0x03, 0xFF, 0xFF, 
-0x05, 0xA0, 0xFF, 0x9C, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0xFF, 0xE2, 0x51, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x0B, 
-0xD0, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 
-0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xD3, 0xE4, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x22, 
-0xF8, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x43, 0xFF, 0xA0, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0x00, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x30, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xCB, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x32, 0xD3, 0xE4, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x8E, 0xFF, 0x93, 0x00, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0x00, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xD0, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xD3, 0xE4, 0x81, 
-0xFF, 0xFF, 0x66, 0xE0, 0xF1, 0xB8, 0x4A, 0xE4, 0xEC, 0x21, 0xAF, 0xF0, 0xEB, 0x5C, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xD0, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xD3, 0xE4, 0x81, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 
-0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xCB, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xD3, 0xE4, 0x81, 0xFF, 0xFF, 0x00, 0x78, 
-0xFF, 0xFF, 0xFF, 0x77, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x79, 0xFF, 0xFF, 0xFF, 0x78, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xD0, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xD3, 0xE4, 0x81, 
-0xFF, 0xFF, 0x26, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xC6, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x4F, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x04, 0x0E, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFD, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x2C, 0xC9, 0xED, 0x93, 
-0x79, 0xE3, 0xFF, 0xFE, 0xC8, 0x29, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 
-0xC9, 0x2C, 0x00, 0x00, 0x00, 0xFE, 0x39, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0xBE, 0x00, 0xFF, 
-0xFF, 0x02, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 
-0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 
-0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 
-0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 
-0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x43, 0xFF, 
-0xA0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 
-0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD3, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0x00, 
-0x00, 0x00, 0x8E, 0xFF, 0x93, 0x00, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0x00, 0xC1, 0xC0, 0x01, 
-0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 
-0xFE, 0xFE, 0xC9, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 
-0xC9, 0x2C, 0xAA, 0xFF, 0xBE, 0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x22, 0xF8, 0xFF, 0x98, 
-0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x43, 0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 
-0xFF, 0x93, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x66, 0xE0, 0xF1, 0xB8, 0x4A, 0xE4, 0xEC, 0x21, 0xAF, 0xF0, 0xEB, 
-0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x37, 0xDE, 0xE1, 0x50, 0xFF, 0xFF, 0xF6, 
-0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE3, 0x50, 0xFF, 0xFE, 0xFF, 0xFF, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xFF, 0x44, 0x00, 0x00, 
-0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xD5, 0xFE, 0xFE, 0xD5, 
-0x3C, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD5, 0x3D, 0xD6, 0xFE, 0xFE, 0xD6, 0x3D, 0x00, 0x00, 0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0x00, 
-0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x43, 0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x3D, 0xD5, 0xFE, 0xFE, 0xD5, 0x3C, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 
-0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD5, 0x00, 0x3D, 0xD6, 0xFE, 0xFE, 0xD6, 0x3D, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0x93, 0x00, 0x00, 
-0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0x00, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3D, 0xD5, 0xFE, 0xFE, 0xD5, 0x3C, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFE, 0xFF, 0x00, 
-0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x3D, 0xD6, 0xFE, 0xFE, 0xD6, 0x3D, 0x66, 0xE0, 0xF1, 
-0xB8, 0x4A, 0xE4, 0xEC, 0x21, 0xAF, 0xF0, 0xEB, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 
-0xD5, 0xFE, 0xFE, 0xD5, 0x3C, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD6, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x3D, 0xD6, 0xFE, 0xFE, 0xD6, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xD5, 0xFE, 
-0xFE, 0xD5, 0x3C, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xD6, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xD5, 0x3D, 0xD6, 0xFE, 0xFE, 0xD6, 0x3D, 0x00, 0x00, 0xC5, 0xC4, 0x00, 0x00, 0x00, 
-0x00, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x39, 0xE4, 0x15, 0x2C, 
-0xC8, 0xFE, 0xFF, 0xDE, 0x3B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xDC, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x3B, 0xE0, 0xFF, 0xFE, 0xC9, 0x2C, 0x16, 0xE6, 0x38, 0x00, 0x00, 
-0x00, 0xBD, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 
-0xFF, 0x44, 0x00, 0x00, 0x00, 0x20, 0xEB, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x22, 0xF8, 
-0xFF, 0x98, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x00, 0x43, 0xFF, 0xA0, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC9, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8E, 
-0xFF, 0x93, 0x00, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0x00, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 
-0x00, 0x22, 0xF8, 0xFF, 0x98, 0x00, 0x00, 0xAF, 0xFF, 0x9C, 0x01, 0x00, 0x43, 0xFF, 0xA0, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x11, 0x11, 0xFF, 0xE5, 0xB3, 0xFF, 0x34, 
-0x35, 0xFF, 0xB2, 0x80, 0xFF, 0x57, 0x58, 0xFF, 0x7F, 0x4D, 0xFF, 0x7B, 0x7C, 0xFF, 0x4B, 0x1A, 
-0xFF, 0x9E, 0x9F, 0xFF, 0x18, 0x00, 0xE6, 0xC1, 0xC2, 0xE4, 0x00, 0x00, 0xB3, 0xE5, 0xE6, 0xB1, 
-0x00, 0x00, 0x80, 0xFE, 0xFF, 0x7D, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x1A, 0xFF, 
-0xFF, 0x17, 0x00, 0x00, 0x20, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x9D, 0x00, 0x00, 0x00, 
-0xA1, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x11, 
-0x11, 0xFF, 0xE5, 0xB3, 0xFF, 0x34, 0x35, 0xFF, 0xB2, 0x80, 0xFF, 0x57, 0x58, 0xFF, 0x7F, 0x4D, 
-0xFF, 0x7B, 0x7C, 0xFF, 0x4B, 0x1A, 0xFF, 0x9E, 0x9F, 0xFF, 0x18, 0x00, 0xE6, 0xC1, 0xC2, 0xE4, 
-0x00, 0x00, 0xB3, 0xE5, 0xE6, 0xB1, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0x7D, 0x00, 0x00, 0x4D, 0xFF, 
-0xFF, 0x4A, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x17, 0x00, 0x00, 0x20, 0xFF, 0xDD, 0x00, 0x00, 0x00, 
-0x61, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1B, 0xAE, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0xFA, 0x00, 0x2D, 
-0xFF, 0xFF, 0xC5, 0x2B, 0x00, 0xFB, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xB8, 0x1B, 0xFF, 0xFF, 0xF6, 0xF6, 
-0xFF, 0xFF, 0x1C, 0xBA, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0C, 0x0C, 0x0C, 0xC9, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x2C, 0xC8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xC9, 0x2C, 0x00, 0xC1, 0xC8, 0x08, 0xCB, 0xC1, 0x00, 0x00, 0x2C, 0xFB, 0xD3, 
-0xFC, 0x2E, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3D, 0xD0, 0xFE, 0xFF, 0xFE, 0xD0, 0x3D, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xFF, 0x21, 
-0x00, 0x00, 0xFF, 0xFF, 0x8C, 0xFF, 0xE2, 0x24, 0x00, 0x00, 0x00, 0x01, 0x95, 0xFF, 0xE6, 0x29, 
-0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE9, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xED, 0x32, 
-0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDB, 0x3D, 0xD1, 0xFE, 0xFF, 0xFE, 0xD1, 0x3D, 0x00, 0xC1, 0xC8, 0x08, 0xCB, 0xC1, 
-0x00, 0x2C, 0xFB, 0xD3, 0xFC, 0x2E, 0x00, 0x00, 0x8D, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x2B, 0xC7, 0xFE, 0xFE, 0xC7, 0x2B, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 
-0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x66, 0xE6, 0xFD, 0x93, 0x0F, 0x00, 
-0x00, 0x0E, 0x94, 0xFD, 0xE6, 0x67, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 
-0xFF, 0xFE, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x2C, 0xC9, 0xFE, 0xFE, 0xC9, 0x2C, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xFF, 0x27, 0x00, 0x00, 0x27, 0xFF, 0xDD, 0x8D, 0xFF, 
-0x77, 0x00, 0x00, 0x76, 0xFF, 0x8B, 0x3C, 0xFF, 0xC7, 0x00, 0x00, 0xC5, 0xFF, 0x39, 0x02, 0xE7, 
-0xFE, 0x19, 0x16, 0xFD, 0xE6, 0x01, 0x00, 0x98, 0xFF, 0x67, 0x62, 0xFF, 0x96, 0x00, 0x00, 0x47, 
-0xFF, 0xB7, 0xB1, 0xFF, 0x44, 0x00, 0x00, 0x05, 0xEE, 0xF9, 0xF6, 0xEB, 0x04, 0x00, 0x00, 0x00, 
-0x99, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 
-0x08, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC1, 
-0xC8, 0x08, 0xCB, 0xC1, 0x00, 0x00, 0x2C, 0xFB, 0xD3, 0xFC, 0x2E, 0x00, 0x00, 0x00, 0x8D, 0xFF, 
-0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x77, 0x00, 
-0x00, 0x00, 0x00, 0xA3, 0xF7, 0x13, 0x00, 0x00, 0x00, 0x15, 0xF8, 0x9D, 0x00, 0x00, 0x00, 0x00, 
-0x7B, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0x56, 
-0x00, 0x00, 0x00, 0x00, 0xBF, 0xE5, 0x04, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x7C, 0x00, 0x00, 0x00, 
-0x00, 0x97, 0xF9, 0x16, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 
-0x36, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x00, 0xC1, 0xC8, 0x08, 0xCB, 0xC1, 0x00, 0x2C, 0xFB, 0xD3, 0xFC, 0x2E, 0x00, 
-0x00, 0x8D, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x07, 0xE2, 0xFF, 0x7B, 0x00, 0x00, 0x6E, 
-0xFF, 0xEA, 0x0C, 0x00, 0x0A, 0xE7, 0xFF, 0x72, 0x00, 0x00, 0x75, 0xFF, 0xE5, 0x08, 0x00, 0x0D, 
-0xEB, 0xFF, 0x6A, 0x00, 0x00, 0x7D, 0xFF, 0xE0, 0x06, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFE, 0xFF, 0xF0, 0x00, 
-0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xEC, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x56, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xA2, 0x00, 0x00, 0x00, 
-0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0xFB, 0x03, 0x00, 
-0x00, 0x00, 0xD4, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x20, 0x00, 0x00, 0x00, 
-0x00, 0x13, 0xFF, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x53, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x92, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xD1, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x26, 0x00, 0x00, 0x00, 0xCB, 
-0xFF, 0xFF, 0xFD, 0x08, 0x00, 0x00, 0x00, 0xEE, 0xFF, 0xFC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x8E, 0xFF, 0x93, 0x00, 0x2C, 0xFB, 0xAA, 0xFC, 0x2E, 0xC1, 0xC0, 0x01, 0xC2, 0xC1, 0xC1, 0xC8, 
-0x08, 0xCB, 0xC1, 0x2C, 0xFB, 0xD3, 0xFC, 0x2E, 0x00, 0x8D, 0xFF, 0x93, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0xFF, 0x77, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0xFF, 
-0x78, 0x59, 0xFF, 0xC3, 0x00, 0xE5, 0xFF, 0x32, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 
-0xFF, 0x66, 0xE0, 0xF1, 0xB8, 0x4A, 0xE4, 0xEC, 0x21, 0xAF, 0xF0, 0xEB, 0x5C, 0x5B, 0xD9, 0x00, 
-0x5B, 0xD9, 0x9F, 0x82, 0x00, 0x9F, 0x82, 0xE3, 0x2B, 0x00, 0xE3, 0x2B, 0x00, 0xC3, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xC3, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x33, 0xE5, 0x00, 
-0x9A, 0xB2, 0x0C, 0xF3, 0x7F, 0x67, 0xFF, 0x4C, 0xCD, 0xFF, 0x19, 0x19, 0xFF, 0xCC, 0x4D, 0xFF, 
-0x66, 0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0x20, 0xFF, 0xBF, 0x61, 0xFF, 0x3F, 
-0xA1, 0xBF, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x33, 0xE5, 0x00, 0x33, 0xE5, 0x00, 0x9A, 0xB2, 0x00, 
-0x9A, 0xB2, 0x0C, 0xF3, 0x7F, 0x0C, 0xF3, 0x7F, 0x67, 0xFF, 0x4C, 0x67, 0xFF, 0x4C, 0xCD, 0xFF, 
-0x19, 0xCD, 0xFF, 0x19, 0x19, 0xFF, 0xCC, 0x19, 0xFF, 0xCC, 0x4D, 0xFF, 0x66, 0x4D, 0xFF, 0x66, 
-0x80, 0xF3, 0x0C, 0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0xE6, 
-0x33, 0x00, 0x19, 0xFF, 0xCC, 0x19, 0xFF, 0xCC, 0x4D, 0xFF, 0x66, 0x4D, 0xFF, 0x66, 0x80, 0xF3, 
-0x0C, 0x80, 0xF3, 0x0C, 0xB3, 0x99, 0x00, 0xB3, 0x99, 0x00, 0xE6, 0x33, 0x00, 0xE6, 0x33, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x51, 0xE1, 0xFF, 0xFF, 0xFE, 0xE1, 0x50, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xE1, 0x51, 0xE2, 0xFF, 0xFF, 0xFF, 0xE2, 0x51, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x51, 0xE1, 0xFE, 0xE1, 0x50, 0x00, 0x00, 0x00, 
-0x00, 0x4E, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x00, 0xFF, 0xE1, 0x00, 
-0x00, 0x00, 0x0A, 0xDF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFE, 0x00, 0x00, 0x00, 0x87, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x29, 0xEA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xCC, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x00, 0xFF, 0xE1, 0x0F, 0xE6, 0x34, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xE2, 0xFE, 0xE2, 0x51, 0x95, 0x95, 0x51, 0xE1, 0xFE, 
-0xE1, 0x50, 0x00, 0x51, 0xE1, 0xFE, 0xE1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x34, 0xE6, 0x10, 0xE2, 
-0xFF, 0x00, 0xFF, 0xE1, 0x00, 0xE2, 0xFF, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x02, 0xCB, 0x5C, 
-0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6A, 
-0xBF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0x16, 0xE9, 0x29, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xA3, 0x87, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x40, 0xDF, 0x0A, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x00, 0xFF, 0xE1, 0x00, 0xE2, 
-0xFF, 0x00, 0xFF, 0xE1, 0x00, 0xD6, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x51, 0xE2, 0xFE, 0xE2, 0x51, 
-0x00, 0x51, 0xE2, 0xFE, 0xE2, 0x51, 0x00, 0x00, 0x72, 0xFF, 0x9D, 0x00, 0x5A, 0xFE, 0xBA, 0x04, 
-0x44, 0xFA, 0xD1, 0x0E, 0x00, 0xE5, 0xFF, 0x37, 0x00, 0x00, 0x44, 0xFA, 0xCE, 0x0C, 0x00, 0x00, 
-0x5A, 0xFE, 0xB3, 0x02, 0x00, 0x00, 0x73, 0xFF, 0x92, 0x92, 0xFF, 0x72, 0x00, 0x00, 0x03, 0xB4, 
-0xFE, 0x59, 0x00, 0x00, 0x0C, 0xCF, 0xF9, 0x44, 0x00, 0x00, 0x37, 0xFF, 0xE4, 0x00, 0x0E, 0xD1, 
-0xF9, 0x44, 0x04, 0xBA, 0xFE, 0x5A, 0x00, 0x9E, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x47, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
-0xF6, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE6, 0x85, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x7E, 0xEB, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xF3, 
-0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xDC, 0x05, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x27, 0xFB, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xC8, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xC7, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFC, 0x29, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDB, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x6D, 0xF4, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEA, 0x81, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xE8, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x15, 0xF6, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xD9, 0xFF, 
-0xFF, 0xFF, 0xD9, 0x3C, 0x00, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x00, 0x3C, 0xD9, 0xFF, 
-0xFF, 0xFF, 0xD9, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x34, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x89, 0x00, 0x82, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0xD5, 0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0x40, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE3, 0xD4, 0xE1, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x9A, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xFF, 0xFF, 0x5B, 0xFF, 0x52, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x17, 
-0xFA, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-0x00, 0xB9, 0x48, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xD3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x6B, 
-0x00, 0x00, 0x00, 0x00, 0x1A, 0xE1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x83, 0x8F, 0x00, 0x00, 0x00, 
-0x00, 0x0C, 0xE2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x67, 0xB2, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x3E, 0xFF, 0x47, 0x00, 
-0x00, 0x00, 0x00, 0x72, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xCA, 0xAC, 0x00, 0x00, 0x00, 
-0x00, 0xDA, 0x60, 0xDF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x08, 0xF6, 0x13, 0x00, 0x00, 0x42, 0xC4, 
-0x00, 0xC6, 0x47, 0x00, 0x00, 0x76, 0x8F, 0x00, 0x90, 0x7B, 0x00, 0x00, 0xAA, 0x5A, 0x00, 0x5B, 
-0xAE, 0x00, 0x00, 0xDD, 0x24, 0x00, 0x26, 0xE1, 0x00, 0x11, 0xEE, 0x01, 0x00, 0x01, 0xEF, 0x15, 
-0x45, 0xBA, 0x00, 0x00, 0x00, 0xBB, 0x48, 0x79, 0x84, 0x00, 0x00, 0x00, 0x86, 0x7B, 0xAD, 0x4F, 
-0x00, 0x00, 0x00, 0x50, 0xAE, 0xE1, 0x1A, 0x00, 0x00, 0x00, 0x1B, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xB3, 0x56, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE1, 0x16, 0x00, 0x00, 0x00, 0x00, 
-0x78, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x05, 0xD4, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xEC, 0x19, 
-0x00, 0x00, 0x00, 0x00, 0x9E, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-0x9B, 0xB8, 0x00, 0x00, 0x00, 0x36, 0xEE, 0x1C, 0x00, 0x00, 0x02, 0xCC, 0x5E, 0x00, 0x00, 0x00, 
-0x69, 0xB1, 0x00, 0x00, 0x00, 0x14, 0xDA, 0x17, 0x00, 0x00, 0x00, 0x9E, 0x56, 0x00, 0x00, 0x00, 
-0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 
-0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0xE4, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xC8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 
-0xFD, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xB4, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFB, 0xFA, 0x12, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x4D, 0x00, 0xC9, 
-0xFF, 0x5B, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xDE, 0x2E, 0xFF, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-0xB8, 0xFF, 0xE3, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 0xFF, 
-0xED, 0x37, 0x00, 0x33, 0xEB, 0xFF, 0xFF, 0xC8, 0xFF, 0x00, 0x00, 0x6B, 0xDD, 0x10, 0xD7, 0x63, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xC5, 0xDC, 0xC2, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0x00, 0x00, 0x4C, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC1, 0xD5, 0xC8, 
-0x02, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x61, 0xD7, 0x0C, 0xD6, 0x68, 0x00, 0x00, 0xFF, 0xCB, 
-0xFF, 0xFF, 0xEC, 0x39, 0x00, 0x32, 0xEB, 0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x4E, 0xE0, 0xFF, 0x00, 
-0x00, 0xDE, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 
-0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 
-0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 
-0x00, 0xD8, 0x00, 0x00, 0xFC, 0xD4, 0x3A, 0x00, 0x00, 0xCE, 0xDB, 0x86, 0x1B, 0x00, 0x00, 0xFF, 
-0xFF, 0x38, 0xA8, 0xF6, 0xA7, 0x37, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0x87, 0xDC, 0xCE, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xDB, 0x86, 0x1B, 0x00, 0x00, 0xFF, 0xFF, 0x38, 0xA8, 0xF6, 
-0xA7, 0x37, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0x87, 0xDC, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x25, 0xB5, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x5C, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x64, 0xC0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x62, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0x5D, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x6F, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xB6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xAE, 0x00, 
-0x02, 0x6B, 0xD5, 0x50, 0x2D, 0xC4, 0x91, 0x0C, 0x00, 0xF7, 0x66, 0x00, 0x00, 0x00, 0x31, 0xC9, 
-0x8F, 0x0C, 0x00, 0x00, 0x03, 0x73, 0xD8, 0x4F, 0x00, 0x00, 0x00, 0x21, 0xB8, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xB7, 0x1F, 0x00, 0x00, 0x00, 0x50, 0xD7, 0x70, 0x02, 0x00, 0x00, 0x0D, 0x91, 0xC6, 
-0x2E, 0x00, 0x00, 0x00, 0x66, 0xF6, 0x00, 0x0C, 0x8F, 0xC7, 0x30, 0x4F, 0xD5, 0x6E, 0x02, 0x00, 
-0xB0, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x31, 0xF5, 0x35, 0x00, 
-0x00, 0x00, 0x09, 0xCE, 0x5A, 0xD1, 0x0A, 0x00, 0x00, 0x96, 0x6D, 0x00, 0x6E, 0x98, 0x00, 0x4B, 
-0xB5, 0x00, 0x00, 0x00, 0xB5, 0x4C, 0xD3, 0x2D, 0x00, 0x00, 0x00, 0x2E, 0xD3, 0x4B, 0xB4, 0x00, 
-0x00, 0x00, 0xB5, 0x4C, 0x00, 0x96, 0x6D, 0x00, 0x6E, 0x98, 0x00, 0x00, 0x09, 0xCE, 0x59, 0xD1, 
-0x0B, 0x00, 0x00, 0x00, 0x31, 0xF5, 0x36, 0x00, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFE, 0xC8, 0x2B, 
-0x00, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 
-0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0x2C, 0xC8, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x41, 0x67, 0x65, 0x6E, 
-0x63, 0x79, 0x20, 0x46, 0x42, 0x20, 0x42, 0x6F, 0x6C, 0x64, 0x00, 0x0D, 0x41, 0x67, 0x65, 0x6E, 
-0x63, 0x79, 0x46, 0x42, 0x2D, 0x42, 0x6F, 0x6C, 0x64, 0x01};
\ No newline at end of file
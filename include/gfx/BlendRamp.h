@@ -0,0 +1,74 @@
+#ifndef GFX_BLEND_RAMP_H
+#define GFX_BLEND_RAMP_H
+
+#include <stdint.h>
+#include "gfx/Rgb565.h"
+
+// Every blend of one colour over one opaque background, as panel pixels.
+// blend565() only keeps 5 bits of alpha, so 33 entries cover all 256
+// alphas exactly and a lookup gives the same pixel as the arithmetic.
+struct BlendRamp
+{
+    static constexpr int levels = 33;
+
+    uint16_t fg = 0; // RGB565
+    uint16_t bg = 0;
+    uint16_t solid = 0; // fg in panel order
+    uint16_t level[levels] = {};
+    uint16_t nibble[16] = {}; // By 4-bit alpha, as packed glyphs store it
+
+    void build(uint16_t f, uint16_t b)
+    {
+        fg = f;
+        bg = b;
+        solid = toPanel565(f);
+        for (int i = 0; i < levels; i++)
+        {
+            uint8_t alpha = i ? i * 8 - 1 : 0; // Any alpha with (alpha + 4) >> 3 == i
+            level[i] = toPanel565(b ? blend565(alpha, f, b) : scale565(alpha, f));
+        }
+        for (int i = 0; i < 16; i++)
+            nibble[i] = at(i * 17);
+    }
+
+    uint16_t at(uint8_t alpha) const { return level[(alpha + 4) >> 3]; }
+};
+
+// Ramps for the colour pairs drawn lately. The UI draws everything over
+// black in a handful of colours, so a few slots hold all of them and a ramp
+// is built once, not per frame. A full cache replaces its oldest ramp; a
+// reference stays valid until the next get().
+template <int Slots>
+class RampCache
+{
+private:
+    BlendRamp ramps[Slots];
+    int used = 0;
+    int next = 0;
+    uint32_t hitCount = 0;
+    uint32_t buildCount = 0;
+
+public:
+    const BlendRamp &get(uint16_t fg, uint16_t bg)
+    {
+        for (int i = 0; i < used; i++)
+            if (ramps[i].fg == fg && ramps[i].bg == bg)
+            {
+                hitCount++;
+                return ramps[i];
+            }
+
+        BlendRamp &ramp = ramps[next];
+        next = (next + 1) % Slots;
+        if (used < Slots)
+            used++;
+        ramp.build(fg, bg);
+        buildCount++;
+        return ramp;
+    }
+
+    uint32_t hits() const { return hitCount; }
+    uint32_t builds() const { return buildCount; }
+};
+
+#endif // GFX_BLEND_RAMP_H
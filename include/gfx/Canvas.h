@@ -0,0 +1,466 @@
+#ifndef GFX_CANVAS_H
+#define GFX_CANVAS_H
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "gfx/BlendRamp.h"
+#include "gfx/DirtyRegion.h"
+#include "gfx/GlyphAtlas.h"
+#include "gfx/GlyphRuns.h"
+#include "gfx/RenderTarget.h"
+#include "gfx/Rgb565.h"
+#include "gfx/VlwFont.h"
+
+// Software renderer for the handful of primitives the UI uses: fills,
+// anti-aliased circles, wedge lines and arcs, and smooth (.vlw) text. It
+// draws straight into a RenderTarget's surface, so the device and the
+// host produce the same pixels. Every write is clipped to the clip rect.
+// Colours are taken as RGB565 and written in panel order.
+class Canvas
+{
+public:
+    // Text datums, as in TFT_eSPI: column = datum % 3, row = datum / 3
+    enum Datum : uint8_t
+    {
+        TL_DATUM = 0,
+        TC_DATUM = 1,
+        TR_DATUM = 2,
+        ML_DATUM = 3,
+        MC_DATUM = 4,
+        MR_DATUM = 5,
+        BL_DATUM = 6,
+        BC_DATUM = 7,
+        BR_DATUM = 8
+    };
+
+private:
+    RenderTarget &target;
+    Surface *fb = nullptr;
+    int w = 0;
+    int h = 0;
+    Rect clip;
+    const RoundMask *mask = nullptr;
+
+    const VlwFont *font = nullptr;
+    uint16_t textFg = 0xFFFF;
+    uint16_t textBg = 0x0000;
+    uint8_t datum = TL_DATUM;
+
+    // Anti-aliased edges and text look their blends up here instead of
+    // mixing every pixel; a primitive fetches its ramp once
+    RampCache<8> ramps;
+
+    static float clamp01(float v) { return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v); }
+
+    // Box of the pixels that may be touched, limited to the clip rect
+    Rect bounds(float left, float top, float right, float bottom) const
+    {
+        int x0 = (int)floorf(left), y0 = (int)floorf(top);
+        int x1 = (int)ceilf(right) + 1, y1 = (int)ceilf(bottom) + 1;
+        Rect r(x0, y0, x1 - x0, y1 - y0);
+        int cx0 = r.x > clip.x ? r.x : clip.x;
+        int cy0 = r.y > clip.y ? r.y : clip.y;
+        int cx1 = r.right() < clip.right() ? r.right() : clip.right();
+        int cy1 = r.bottom() < clip.bottom() ? r.bottom() : clip.bottom();
+        return Rect(cx0, cy0, cx1 - cx0, cy1 - cy0);
+    }
+
+    void plot(int x, int y, float coverage, const BlendRamp &ramp)
+    {
+        uint8_t alpha = (uint8_t)(coverage * 255.0f + 0.5f);
+        if (alpha)
+            fb->set(x, y, alpha == 255 ? ramp.solid : ramp.at(alpha));
+    }
+
+    static int measure(const VlwFont &f, const char *s)
+    {
+        int width = 0;
+        for (; *s; s++)
+        {
+            const VlwFont::Glyph *g = f.find((uint8_t)*s);
+            if (!g)
+                width += f.spaceWidth() + (*s == ' ' ? 0 : 1);
+            else if (s[1])
+                width += g->xAdvance;
+            else // The last glyph counts to its ink, not its advance
+                width += g->dX + g->width > g->xAdvance ? g->dX + g->width : g->xAdvance;
+        }
+        return width;
+    }
+
+    void blitGlyph(const GlyphAtlas &atlas, const GlyphAtlas::Cell &cell, int x, int y)
+    {
+        const VlwFont::Glyph &g = *cell.glyph;
+        int left = x + g.dX;
+        int top = y + atlas.font().ascent() - g.dY;
+        int x0 = left > clip.x ? left : clip.x;
+        int x1 = left + g.width < clip.right() ? left + g.width : clip.right();
+        if (x0 >= x1)
+            return;
+
+        const uint16_t *src = atlas.rows(cell) + (x0 - left);
+        for (int row = 0; row < g.height; row++)
+        {
+            int py = top + row;
+            if (py >= clip.y && py < clip.bottom())
+                fb->copy(py, x0, src + row * g.width, x1 - x0);
+        }
+    }
+
+    int drawGlyph(const VlwFont::Glyph &g, const BlendRamp &ramp, int x, int y)
+    {
+        const uint8_t *alpha = font->bitmap(g);
+        int left = x + g.dX;
+        int top = y + font->ascent() - g.dY;
+
+        for (int row = 0; row < g.height; row++)
+        {
+            int py = top + row;
+            if (py < clip.y || py >= clip.bottom())
+                continue;
+            const uint8_t *src = alpha + row * g.width;
+            for (int col = 0; col < g.width; col++)
+            {
+                int px = left + col;
+                if (src[col] && px >= clip.x && px < clip.right())
+                    fb->set(px, py, src[col] == 255 ? ramp.solid : ramp.at(src[col]));
+            }
+        }
+        return g.xAdvance;
+    }
+
+    // Pixels [x0, x1) of row y from 4-bit alphas, the first of them at
+    // nibble n; taken a byte, two pixels, at a time. 0 leaves a pixel be.
+    void drawNibbles(const uint8_t *alphas, int n, const BlendRamp &ramp, int x0, int x1, int y)
+    {
+        if (x0 >= x1)
+            return;
+        const uint8_t *a = alphas + (n >> 1);
+        int x = x0;
+        if (n & 1)
+        {
+            if (*a >> 4)
+                fb->set(x, y, ramp.nibble[*a >> 4]);
+            a++;
+            x++;
+        }
+        for (; x + 1 < x1; x += 2, a++)
+        {
+            uint8_t pair = *a;
+            if (pair & 15)
+                fb->set(x, y, ramp.nibble[pair & 15]);
+            if (pair >> 4)
+                fb->set(x + 1, y, ramp.nibble[pair >> 4]);
+        }
+        if (x < x1 && *a & 15)
+            fb->set(x, y, ramp.nibble[*a & 15]);
+    }
+
+    // A glyph wholly inside the clip: the tokens are read here, without
+    // cutting runs at the clip, and mixed runs a byte of alphas at a time
+    void drawPackedUnclipped(const VlwFont::Glyph &g, const BlendRamp &ramp, int left, int top)
+    {
+        const uint8_t *p = font->bitmap(g);
+        int col = 0, py = top;
+        for (int remaining = g.width * g.height; remaining > 0;)
+        {
+            uint8_t token = *p++;
+            int count = (token & 0x3F) + 1;
+            remaining -= count;
+            if (token < 0x40)
+            {
+                for (col += count; col >= g.width; py++)
+                    col -= g.width;
+            }
+            else if (token < 0x80)
+            {
+                while (count)
+                {
+                    int n = count < g.width - col ? count : g.width - col;
+                    fb->fill(py, left + col, left + col + n, ramp.solid);
+                    count -= n;
+                    if ((col += n) == g.width)
+                    {
+                        col = 0;
+                        py++;
+                    }
+                }
+            }
+            else
+            {
+                const uint8_t *alphas = p;
+                p += (count + 1) / 2;
+                for (int first = 0; count;)
+                {
+                    int n = count < g.width - col ? count : g.width - col;
+                    drawNibbles(alphas, first, ramp, left + col, left + col + n, py);
+                    first += n;
+                    count -= n;
+                    if ((col += n) == g.width)
+                    {
+                        col = 0;
+                        py++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Decodes the runs straight onto the surface: transparent runs are
+    // skipped and solid ones filled, so only edge pixels are looked up
+    int drawPackedGlyph(const VlwFont::Glyph &g, const BlendRamp &ramp, int x, int y)
+    {
+        GlyphRuns runs(font->bitmap(g));
+        int left = x + g.dX;
+        int top = y + font->ascent() - g.dY;
+        if (left >= clip.x && left + g.width <= clip.right() && top >= clip.y && top + g.height <= clip.bottom())
+        {
+            drawPackedUnclipped(g, ramp, left, top);
+            return g.xAdvance;
+        }
+
+        for (int row = 0; row < g.height && top + row < clip.bottom(); row++)
+        {
+            int py = top + row;
+            bool visible = py >= clip.y;
+            for (int col = 0; col < g.width;)
+            {
+                GlyphRuns::Span span = runs.next(g.width - col);
+                int px = left + col;
+                col += span.count;
+                if (!visible || span.kind == GlyphRuns::CLEAR)
+                    continue;
+
+                int x0 = px > clip.x ? px : clip.x;
+                int x1 = px + span.count < clip.right() ? px + span.count : clip.right();
+                if (span.kind == GlyphRuns::SOLID)
+                {
+                    if (x0 < x1)
+                        fb->fill(py, x0, x1, ramp.solid);
+                    continue;
+                }
+                drawNibbles(span.alphas, span.first + x0 - px, ramp, x0, x1, py);
+            }
+        }
+        return g.xAdvance;
+    }
+
+public:
+    explicit Canvas(RenderTarget &target) : target(target) {}
+
+    bool begin()
+    {
+        if (!target.begin())
+            return false;
+        fb = &target.surface();
+        w = target.width();
+        h = target.height();
+        mask = target.mask();
+        resetClip();
+        return true;
+    }
+
+    static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return rgb565(r, g, b); }
+    static uint16_t blend(uint8_t alpha, uint16_t fg, uint16_t bg) { return blend565(alpha, fg, bg); }
+
+    Surface &surface() { return *fb; }
+    int width() const { return w; }
+    int height() const { return h; }
+
+    void setClip(const Rect &r) { clip = r.clipped(w, h); }
+    void resetClip() { clip = Rect(0, 0, w, h); }
+
+    uint32_t present(const Rect &r) { return target.present(r); }
+
+    // Colours an indexed surface can hold; direct-colour surfaces ignore it
+    void setPalette(const uint16_t *colors, int n)
+    {
+        uint16_t pixels[16];
+        n = n < 16 ? n : 16;
+        for (int i = 0; i < n; i++)
+            pixels[i] = toPanel565(colors[i]);
+        fb->setPalette(pixels, n);
+    }
+    const RoundMask *glass() const { return mask; }
+    uint32_t rampBuilds() const { return ramps.builds(); }
+
+    // Clears never touch the pixels outside the glass
+    void fillRect(int x, int y, int rw, int rh, uint16_t color)
+    {
+        Rect r = bounds(x, y, x + rw - 1, y + rh - 1);
+        uint16_t pixel = toPanel565(color);
+        for (int py = r.y; py < r.bottom(); py++)
+        {
+            int x0 = r.x, x1 = r.right();
+            if (mask)
+                mask->clamp(py, x0, x1);
+            fb->fill(py, x0, x1, pixel);
+        }
+    }
+
+    void fillScreen(uint16_t color) { fillRect(0, 0, w, h, color); }
+
+    void fillSmoothCircle(float x, float y, float r, uint16_t fg, uint16_t bg)
+    {
+        Rect box = bounds(x - r - 1, y - r - 1, x + r + 1, y + r + 1);
+        const BlendRamp &ramp = ramps.get(fg, bg);
+        for (int py = box.y; py < box.bottom(); py++)
+            for (int px = box.x; px < box.right(); px++)
+            {
+                float dx = px - x, dy = py - y;
+                plot(px, py, clamp01(r + 0.5f - sqrtf(dx * dx + dy * dy)), ramp);
+            }
+    }
+
+    // Line from (ax, ay) to (bx, by) whose radius tapers from ar to br,
+    // with round ends
+    void drawWedgeLine(float ax, float ay, float bx, float by, float ar, float br, uint16_t fg, uint16_t bg)
+    {
+        float rMax = ar > br ? ar : br;
+        Rect box = bounds(fminf(ax, bx) - rMax - 1, fminf(ay, by) - rMax - 1, fmaxf(ax, bx) + rMax + 1, fmaxf(ay, by) + rMax + 1);
+        float bax = bx - ax, bay = by - ay;
+        float len2 = bax * bax + bay * bay;
+        const BlendRamp &ramp = ramps.get(fg, bg);
+
+        for (int py = box.y; py < box.bottom(); py++)
+            for (int px = box.x; px < box.right(); px++)
+            {
+                float pax = px - ax, pay = py - ay;
+                float t = len2 > 0.0f ? clamp01((pax * bax + pay * bay) / len2) : 0.0f;
+                float dx = pax - bax * t, dy = pay - bay * t;
+                float edge = ar + (br - ar) * t - sqrtf(dx * dx + dy * dy);
+                plot(px, py, clamp01(edge + 0.5f), ramp);
+            }
+    }
+
+    // Ring segment between radii ir and r. Angles are in degrees, 0 at six
+    // o'clock and increasing clockwise, as in TFT_eSPI.
+    void drawSmoothArc(int x, int y, int r, int ir, int startAngle, int endAngle, uint16_t fg, uint16_t bg, bool roundEnds)
+    {
+        if (ir > r)
+        {
+            int t = r;
+            r = ir;
+            ir = t;
+        }
+        if (startAngle == endAngle)
+            return;
+
+        constexpr float rad = M_PI / 180.0f;
+        float mid = (r + ir) / 2.0f;
+        float capR = (r - ir) / 2.0f;
+        float startX = x - sinf(startAngle * rad) * mid, startY = y + cosf(startAngle * rad) * mid;
+        float endX = x - sinf(endAngle * rad) * mid, endY = y + cosf(endAngle * rad) * mid;
+        float span = fmodf(endAngle - startAngle + 360.0f, 360.0f);
+
+        Rect box = bounds(x - r - 1, y - r - 1, x + r + 1, y + r + 1);
+        const BlendRamp &ramp = ramps.get(fg, bg);
+        for (int py = box.y; py < box.bottom(); py++)
+            for (int px = box.x; px < box.right(); px++)
+            {
+                float dx = px - x, dy = py - y;
+                float d = sqrtf(dx * dx + dy * dy);
+                float radial = fminf(clamp01(r + 0.5f - d), clamp01(d - ir + 0.5f));
+                if (radial <= 0.0f)
+                    continue;
+
+                // Distance in pixels along the ring from either end of the arc
+                float theta = fmodf(atan2f(-dx, dy) / rad - startAngle + 720.0f, 360.0f);
+                float along = theta <= span ? fminf(theta, span - theta) : -fminf(theta - span, 360.0f - theta);
+                float coverage = radial * clamp01(along * rad * d + 0.5f);
+
+                if (roundEnds)
+                {
+                    float sx = px - startX, sy = py - startY, ex = px - endX, ey = py - endY;
+                    float cap = fmaxf(capR + 0.5f - sqrtf(sx * sx + sy * sy), capR + 0.5f - sqrtf(ex * ex + ey * ey));
+                    coverage = fmaxf(coverage, clamp01(cap));
+                }
+                plot(px, py, coverage, ramp);
+            }
+    }
+
+    // Text. The font is borrowed, not copied: it has to stay loaded while
+    // it is selected, and selecting another is free.
+    void setFont(const VlwFont *f) { font = f; }
+    void setTextColor(uint16_t fg, uint16_t bg)
+    {
+        textFg = fg;
+        textBg = bg;
+    }
+    void setTextDatum(uint8_t d) { datum = d; }
+    int fontHeight() const { return font ? font->height() : 0; }
+
+    int textWidth(const char *s) const { return font ? measure(*font, s) : 0; }
+
+    int drawString(const char *s, int x, int y)
+    {
+        if (!font || !font->loaded())
+            return 0;
+
+        int width = textWidth(s);
+        x -= (datum % 3) * width / 2;
+        y -= (datum / 3) * font->height() / 2;
+
+        const BlendRamp &ramp = ramps.get(textFg, textBg);
+        int cursor = x;
+        for (; *s; s++)
+        {
+            const VlwFont::Glyph *g = font->find((uint8_t)*s);
+            if (g)
+                cursor += font->packed() ? drawPackedGlyph(*g, ramp, cursor, y) : drawGlyph(*g, ramp, cursor, y);
+            else
+                cursor += font->spaceWidth() + (*s == ' ' ? 0 : 1);
+        }
+        return cursor - x;
+    }
+
+    // Same layout as drawString with the atlas's font, but glyphs are copied
+    // from the atlas in the colours it was built with
+    int drawString(const GlyphAtlas &atlas, const char *s, int x, int y)
+    {
+        if (!atlas.ready())
+            return 0;
+
+        const VlwFont &f = atlas.font();
+        int width = measure(f, s);
+        x -= (datum % 3) * width / 2;
+        y -= (datum / 3) * f.height() / 2;
+
+        int cursor = x;
+        for (; *s; s++)
+        {
+            const GlyphAtlas::Cell *cell = atlas.find((uint8_t)*s);
+            if (cell)
+            {
+                blitGlyph(atlas, *cell, cursor, y);
+                cursor += cell->glyph->xAdvance;
+            }
+            else
+            {
+                const VlwFont::Glyph *g = f.find((uint8_t)*s);
+                cursor += g ? g->xAdvance : f.spaceWidth() + (*s == ' ' ? 0 : 1);
+            }
+        }
+        return cursor - x;
+    }
+
+    int drawNumber(long n, int x, int y)
+    {
+        char text[12];
+        snprintf(text, sizeof(text), "%ld", n);
+        return drawString(text, x, y);
+    }
+
+    int drawCentreString(const char *s, int x, int y)
+    {
+        uint8_t saved = datum;
+        datum = TC_DATUM;
+        int width = drawString(s, x, y);
+        datum = saved;
+        return width;
+    }
+};
+
+#endif // GFX_CANVAS_H
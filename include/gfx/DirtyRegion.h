@@ -0,0 +1,158 @@
+#ifndef GFX_DIRTY_REGION_H
+#define GFX_DIRTY_REGION_H
+
+#include <stdint.h>
+
+struct Rect
+{
+    int16_t x = 0;
+    int16_t y = 0;
+    int16_t w = 0;
+    int16_t h = 0;
+
+    Rect() = default;
+    Rect(int x, int y, int w, int h) : x(x), y(y), w(w), h(h) {}
+
+    // Box covering the span between two points, grown by pad on every side
+    static Rect around(int x0, int y0, int x1, int y1, int pad)
+    {
+        int left = (x0 < x1 ? x0 : x1) - pad;
+        int top = (y0 < y1 ? y0 : y1) - pad;
+        int right = (x0 > x1 ? x0 : x1) + pad + 1;
+        int bottom = (y0 > y1 ? y0 : y1) + pad + 1;
+        return Rect(left, top, right - left, bottom - top);
+    }
+
+    // Box of a w x h item drawn centred on (cx, cy), i.e. text datum MC
+    static Rect centred(int cx, int cy, int w, int h, int pad)
+    {
+        return Rect(cx - w / 2 - pad, cy - h / 2 - pad, w + 2 * pad, h + 2 * pad);
+    }
+
+    bool empty() const { return w <= 0 || h <= 0; }
+    int32_t area() const { return empty() ? 0 : (int32_t)w * h; }
+    int right() const { return x + w; }
+    int bottom() const { return y + h; }
+
+    bool intersects(const Rect &o) const
+    {
+        return !empty() && !o.empty() && x < o.right() && o.x < right() && y < o.bottom() && o.y < bottom();
+    }
+
+    Rect united(const Rect &o) const
+    {
+        if (empty())
+            return o;
+        if (o.empty())
+            return *this;
+        int left = x < o.x ? x : o.x;
+        int top = y < o.y ? y : o.y;
+        int r = right() > o.right() ? right() : o.right();
+        int b = bottom() > o.bottom() ? bottom() : o.bottom();
+        return Rect(left, top, r - left, b - top);
+    }
+
+    Rect clipped(int width, int height) const
+    {
+        int left = x < 0 ? 0 : x;
+        int top = y < 0 ? 0 : y;
+        int r = right() > width ? width : right();
+        int b = bottom() > height ? height : bottom();
+        return Rect(left, top, r - left, b - top);
+    }
+
+    bool operator==(const Rect &o) const { return x == o.x && y == o.y && w == o.w && h == o.h; }
+    bool operator!=(const Rect &o) const { return !(*this == o); }
+};
+
+// Fixed-capacity set of non-overlapping damaged rectangles for one frame.
+// Overlapping boxes are merged on insert, so every pixel is redrawn and
+// pushed at most once; when the set is full the new box is merged into the
+// entry whose bounds grow the least.
+template <int Capacity>
+class DirtyRegion
+{
+private:
+    Rect rects[Capacity];
+    int count = 0;
+    int16_t width;
+    int16_t height;
+
+    void insert(Rect r)
+    {
+        // Absorb everything the new box touches; a grown box may touch more
+        for (int i = 0; i < count;)
+        {
+            if (rects[i].intersects(r))
+            {
+                r = r.united(rects[i]);
+                rects[i] = rects[--count];
+                i = 0;
+                continue;
+            }
+            i++;
+        }
+
+        if (count < Capacity)
+        {
+            rects[count++] = r;
+            return;
+        }
+
+        int best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (int i = 0; i < count; i++)
+        {
+            int32_t growth = rects[i].united(r).area() - rects[i].area();
+            if (growth < bestGrowth)
+            {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        r = r.united(rects[best]);
+        rects[best] = rects[--count];
+        insert(r);
+    }
+
+public:
+    DirtyRegion(int width, int height) : width(width), height(height) {}
+
+    void clear() { count = 0; }
+
+    void invalidateAll()
+    {
+        rects[0] = Rect(0, 0, width, height);
+        count = 1;
+    }
+
+    void add(const Rect &r)
+    {
+        Rect c = r.clipped(width, height);
+        if (!c.empty())
+            insert(c);
+    }
+
+    bool intersects(const Rect &r) const
+    {
+        for (int i = 0; i < count; i++)
+            if (rects[i].intersects(r))
+                return true;
+        return false;
+    }
+
+    int32_t area() const
+    {
+        int32_t total = 0;
+        for (int i = 0; i < count; i++)
+            total += rects[i].area();
+        return total;
+    }
+
+    int size() const { return count; }
+    const Rect &operator[](int i) const { return rects[i]; }
+    const Rect *begin() const { return rects; }
+    const Rect *end() const { return rects + count; }
+};
+
+#endif // GFX_DIRTY_REGION_H
@@ -0,0 +1,167 @@
+#ifndef GFX_DMA_PUSHER_H
+#define GFX_DMA_PUSHER_H
+
+#include <string.h>
+#include "M5Dial.h"
+#include "gfx/DirtyRegion.h"
+#include "gfx/RoundMask.h"
+#include "gfx/Surface.h"
+#if defined(ESP_PLATFORM)
+#include <esp_heap_caps.h>
+#endif
+
+// Streams framebuffer rectangles, already in panel byte order, to the panel with SPI DMA through two
+// staging buffers: one is filled while the other is on the wire, so the
+// caller goes on rendering and servicing input while a frame streams out.
+// The panel's waitDMA() is the fence taken before every transfer, which is
+// also what makes the buffer filled two transfers ago safe to reuse.
+class DmaPusher
+{
+public:
+    struct Stats
+    {
+        uint64_t busyMicros = 0; // Time the caller kept working while a transfer was in flight
+        uint64_t waitMicros = 0; // Time spent blocked on the fence
+        uint32_t transfers = 0;
+        uint64_t pixels = 0; // Pixels sent, two bytes each on the wire
+    };
+
+private:
+    static constexpr int maxLine = 240; // Row chunk for blocking pushes
+
+    M5GFX &panel;
+    uint16_t *staging[2] = {nullptr, nullptr};
+    int capacity = 0; // Pixels per staging buffer, 0 when pushing blocking
+    int next = 0;
+    bool inFlight = false;
+    unsigned long kickedAt = 0;
+    Stats counters;
+
+    static uint16_t *allocate(size_t bytes)
+    {
+#if defined(ESP_PLATFORM)
+        return (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+#else
+        return (uint16_t *)malloc(bytes);
+#endif
+    }
+
+    void pushBlock(const Surface &fb, const Rect &r)
+    {
+        counters.pixels += r.area();
+        if (!capacity)
+        {
+            uint16_t line[maxLine];
+            for (int y = r.y; y < r.bottom(); y++)
+                for (int x = r.x; x < r.right(); x += maxLine)
+                {
+                    int n = min(maxLine, r.right() - x);
+                    fb.readRow(y, x, n, line);
+                    panel.pushImage(x, y, n, 1, (const lgfx::swap565_t *)line);
+                }
+            return;
+        }
+
+        int rows = capacity / r.w;
+        for (int y = r.y; y < r.bottom(); y += rows)
+        {
+            int h = min(rows, r.bottom() - y);
+            uint16_t *buf = staging[next];
+            for (int i = 0; i < h; i++)
+                fb.readRow(y + i, r.x, r.w, buf + i * r.w);
+
+            fence();
+            panel.pushImageDMA(r.x, y, r.w, h, (const lgfx::swap565_t *)buf);
+            inFlight = true;
+            kickedAt = micros();
+            counters.transfers++;
+            next ^= 1;
+        }
+    }
+
+public:
+    explicit DmaPusher(M5GFX &panel) : panel(panel) {}
+
+    // Falls back to blocking pushes when the staging buffers cannot be allocated
+    bool begin(int pixelsPerBuffer)
+    {
+        staging[0] = allocate(pixelsPerBuffer * sizeof(uint16_t));
+        staging[1] = allocate(pixelsPerBuffer * sizeof(uint16_t));
+        if (staging[0] && staging[1])
+            capacity = pixelsPerBuffer;
+        else
+        {
+            free(staging[0]);
+            free(staging[1]);
+            staging[0] = staging[1] = nullptr;
+        }
+
+        // The display owns its SPI bus, so the transaction is held for good;
+        // ending it would block until the last transfer had finished.
+        panel.startWrite();
+        return capacity > 0;
+    }
+
+    void fence()
+    {
+        if (!inFlight)
+            return;
+
+        unsigned long waitStart = micros();
+        counters.busyMicros += waitStart - kickedAt;
+        panel.waitDMA();
+        counters.waitMicros += micros() - waitStart;
+        inFlight = false;
+    }
+
+    // Sends r, or with a mask only the part of r on the glass. Rows are
+    // grouped into bands whose spans have about the same width, and each band
+    // goes out as one block, so the corners are skipped without paying a
+    // window setup for every row. Returns the pixels sent.
+    uint32_t push(const Surface &fb, const Rect &r, const RoundMask *mask = nullptr)
+    {
+        if (!mask)
+        {
+            pushBlock(fb, r);
+            return r.area();
+        }
+
+        uint32_t sent = 0;
+        for (int y = r.y; y < r.bottom();)
+        {
+            int x0 = r.x, x1 = r.right();
+            mask->clamp(y, x0, x1);
+            if (x0 >= x1)
+            {
+                y++;
+                continue;
+            }
+
+            int end = y + 1;
+            int32_t visible = x1 - x0;
+            while (end < r.bottom())
+            {
+                int a = r.x, b = r.right();
+                mask->clamp(end, a, b);
+                int u0 = min(x0, a), u1 = max(x1, b);
+                int32_t waste = (int32_t)(u1 - u0) * (end - y + 1) - (visible + (b - a));
+                if (a >= b || waste > u1 - u0)
+                    break;
+                x0 = u0;
+                x1 = u1;
+                visible += b - a;
+                end++;
+            }
+
+            Rect band(x0, y, x1 - x0, end - y);
+            pushBlock(fb, band);
+            sent += band.area();
+            y = end;
+        }
+        return sent;
+    }
+
+    const Stats &stats() const { return counters; }
+};
+
+#endif // GFX_DMA_PUSHER_H
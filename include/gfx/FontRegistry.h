@@ -0,0 +1,42 @@
+#ifndef GFX_FONT_REGISTRY_H
+#define GFX_FONT_REGISTRY_H
+
+#include <stdint.h>
+#include "gfx/VlwFont.h"
+
+// Fonts kept resident for the life of the program. Each .vlw array is parsed
+// once when added, and is afterwards looked up by the same array, so picking
+// a font while drawing costs a few pointer compares instead of a re-parse.
+template <int Capacity>
+class FontRegistry
+{
+private:
+    VlwFont fonts[Capacity];
+    const uint8_t *sources[Capacity] = {};
+    int count = 0;
+
+public:
+    // Parses vlw unless it is already resident. Returns false when the
+    // registry is full or the glyph table cannot be allocated.
+    bool add(const uint8_t *vlw)
+    {
+        if (find(vlw))
+            return true;
+        if (count == Capacity || !fonts[count].load(vlw))
+            return false;
+        sources[count++] = vlw;
+        return true;
+    }
+
+    const VlwFont *find(const uint8_t *vlw) const
+    {
+        for (int i = 0; i < count; i++)
+            if (sources[i] == vlw)
+                return &fonts[i];
+        return nullptr;
+    }
+
+    int size() const { return count; }
+};
+
+#endif // GFX_FONT_REGISTRY_H
@@ -0,0 +1,110 @@
+#ifndef GFX_GLYPH_ATLAS_H
+#define GFX_GLYPH_ATLAS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gfx/GlyphRuns.h"
+#include "gfx/Spans565.h"
+#include "gfx/VlwFont.h"
+
+// A few glyphs of a resident font, blended once onto a fixed background
+// colour. Each glyph's ink box is kept as RGB565 rows, so drawing it is one
+// memcpy per row. Only glyphs whose ink stays inside their advance can be
+// held: copying the background of one must never cover its neighbour.
+class GlyphAtlas
+{
+public:
+    static constexpr int maxGlyphs = 16;
+
+    struct Cell
+    {
+        const VlwFont::Glyph *glyph;
+        uint32_t first; // Index of the cell's top-left pixel in pixels[]
+    };
+
+private:
+    const VlwFont *source = nullptr;
+    Cell cells[maxGlyphs];
+    int count = 0;
+    uint16_t *pixels = nullptr;
+
+public:
+    GlyphAtlas() = default;
+    GlyphAtlas(const GlyphAtlas &) = delete;
+    GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+    ~GlyphAtlas() { clear(); }
+
+    // Fails, leaving the atlas empty, if a glyph is missing, overhangs its
+    // advance, or the pixels cannot be allocated
+    bool build(const VlwFont &font, const char *chars, uint16_t fg, uint16_t bg)
+    {
+        clear();
+        if (!font.loaded() || strlen(chars) > maxGlyphs)
+            return false;
+
+        uint32_t total = 0;
+        for (const char *c = chars; *c; c++)
+        {
+            const VlwFont::Glyph *g = font.find((uint8_t)*c);
+            if (!g || g->dX < 0 || g->dX + g->width > g->xAdvance)
+                return false;
+            cells[count++] = {g, total};
+            total += g->width * g->height;
+        }
+
+        pixels = (uint16_t *)malloc(total * sizeof(uint16_t));
+        if (!pixels)
+        {
+            count = 0;
+            return false;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            const VlwFont::Glyph &g = *cells[i].glyph;
+            GlyphRuns runs(font.bitmap(g));
+            uint8_t line[256]; // A packed glyph's row, expanded
+            uint16_t *dst = pixels + cells[i].first;
+            for (int row = 0; row < g.height; row++, dst += g.width)
+            {
+                const uint8_t *alpha = font.packed() ? runs.read(line, g.width) : font.bitmap(g) + row * g.width;
+                Spans::fill(dst, bg, g.width);
+                Spans::blend(dst, alpha, fg, g.width);
+                Spans::swapBytes(dst, dst, g.width); // Copied to the framebuffer as they are
+            }
+            countSwaps(g.width * g.height);
+        }
+        source = &font;
+        return true;
+    }
+
+    void clear()
+    {
+        free(pixels);
+        pixels = nullptr;
+        source = nullptr;
+        count = 0;
+    }
+
+    const Cell *find(uint16_t code) const
+    {
+        for (int i = 0; i < count; i++)
+            if (cells[i].glyph->code == code)
+                return &cells[i];
+        return nullptr;
+    }
+
+    const uint16_t *rows(const Cell &cell) const { return pixels + cell.first; }
+
+    bool ready() const { return source != nullptr; }
+    const VlwFont &font() const { return *source; }
+    uint32_t bytes() const
+    {
+        uint32_t total = 0;
+        for (int i = 0; i < count; i++)
+            total += cells[i].glyph->width * cells[i].glyph->height * sizeof(uint16_t);
+        return total;
+    }
+};
+
+#endif // GFX_GLYPH_ATLAS_H
@@ -0,0 +1,86 @@
+#ifndef GFX_GLYPH_RUNS_H
+#define GFX_GLYPH_RUNS_H
+
+#include <stdint.h>
+
+// Reads the run stream of a packed glyph (tools/packfont.py) front to back.
+// Each token byte starts a run of 1-64 pixels: 0x00-0x3F transparent,
+// 0x40-0x7F solid, 0x80-0xBF mixed with their 4-bit alphas following, two
+// to a byte. Runs carry on across rows; next() cuts them at any length, so
+// a caller can stop at the end of a row or of its clip.
+class GlyphRuns
+{
+public:
+    enum Kind : uint8_t
+    {
+        CLEAR,
+        SOLID,
+        MIXED
+    };
+
+    struct Span
+    {
+        Kind kind;
+        int count;
+        const uint8_t *alphas; // MIXED only
+        int first;             // Nibble of the span's first pixel
+
+        uint8_t level(int i) const // 0-15
+        {
+            int n = first + i;
+            uint8_t pair = alphas[n >> 1];
+            return n & 1 ? pair >> 4 : pair & 15;
+        }
+
+        uint8_t alpha(int i) const { return level(i) * 17; }
+    };
+
+private:
+    const uint8_t *p;
+    Kind kind = CLEAR;
+    int left = 0; // Pixels left in the current run
+    const uint8_t *alphas = nullptr;
+    int used = 0; // Pixels of the current run already handed out
+
+public:
+    explicit GlyphRuns(const uint8_t *stream) : p(stream) {}
+
+    // The next at most max pixels, all of one kind
+    Span next(int max)
+    {
+        if (!left)
+        {
+            uint8_t token = *p++;
+            kind = token < 0x40 ? CLEAR : token < 0x80 ? SOLID : MIXED;
+            left = (token & 0x3F) + 1;
+            used = 0;
+            if (kind == MIXED)
+            {
+                alphas = p;
+                p += (left + 1) / 2;
+            }
+        }
+        Span span = {kind, left < max ? left : max, alphas, used};
+        left -= span.count;
+        used += span.count;
+        return span;
+    }
+
+    // Where the next token will be read from
+    const uint8_t *position() const { return p; }
+
+    // Expands the next n pixels to 8-bit alpha
+    const uint8_t *read(uint8_t *out, int n)
+    {
+        for (int i = 0; i < n;)
+        {
+            Span span = next(n - i);
+            for (int j = 0; j < span.count; j++)
+                out[i + j] = span.kind == CLEAR ? 0 : span.kind == SOLID ? 255 : span.alpha(j);
+            i += span.count;
+        }
+        return out;
+    }
+};
+
+#endif // GFX_GLYPH_RUNS_H
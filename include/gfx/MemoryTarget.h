@@ -0,0 +1,64 @@
+#ifndef GFX_MEMORY_TARGET_H
+#define GFX_MEMORY_TARGET_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "gfx/RenderTarget.h"
+#include "gfx/Spans565.h"
+
+// The host backend: presenting copies into a second buffer that stands in
+// for the glass, so what a real panel would show can be inspected. Like the
+// panel, the glass decodes the framebuffer's byte order back to RGB565.
+class MemoryTarget : public RenderTarget
+{
+private:
+    int w;
+    int h;
+    Surface fb;
+    uint16_t *screen = nullptr;
+    uint32_t presented = 0;
+    RoundMask glass;
+
+public:
+    MemoryTarget(int width = 240, int height = 240) : w(width), h(height), glass(width) {}
+    ~MemoryTarget()
+    {
+        free(screen);
+    }
+
+    bool begin() override
+    {
+        screen = (uint16_t *)calloc(w * h, sizeof(uint16_t));
+        return fb.allocate(w, h) && screen;
+    }
+
+    Surface &surface() override { return fb; }
+    int width() const override { return w; }
+    int height() const override { return h; }
+
+    uint32_t present(const Rect &r) override
+    {
+        uint32_t sent = 0;
+        for (int y = r.y; y < r.bottom(); y++)
+        {
+            int x0 = r.x, x1 = r.right();
+            if (mask())
+                mask()->clamp(y, x0, x1);
+            if (x0 >= x1)
+                continue;
+            fb.readRow(y, x0, x1 - x0, screen + y * w + x0);
+            Spans::swapBytes(screen + y * w + x0, screen + y * w + x0, x1 - x0);
+            sent += x1 - x0;
+        }
+        presented += sent;
+        return sent;
+    }
+
+    // Mirrors the M5Dial panel, including its round glass
+    const RoundMask *mask() const override { return ROUND_GLASS_MASK && w == h ? &glass : nullptr; }
+
+    const uint16_t *glassPixels() const { return screen; }
+    uint32_t presentedPixels() const { return presented; }
+};
+
+#endif // GFX_MEMORY_TARGET_H
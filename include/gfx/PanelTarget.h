@@ -0,0 +1,38 @@
+#ifndef GFX_PANEL_TARGET_H
+#define GFX_PANEL_TARGET_H
+
+#include "M5Dial.h"
+#include "gfx/RenderTarget.h"
+#include "gfx/DmaPusher.h"
+
+// The device backend: a framebuffer in internal RAM presented to the M5Dial
+// panel through double-buffered SPI DMA.
+class PanelTarget : public RenderTarget
+{
+private:
+    static constexpr int panelWidth = 240;
+    static constexpr int panelHeight = 240;
+    static constexpr int stagingPixels = panelWidth * 20; // Per DMA staging buffer
+
+    Surface fb;
+    DmaPusher pusher{M5Dial.Display};
+    RoundMask glass{panelWidth};
+
+public:
+    bool begin() override
+    {
+        bool allocated = fb.allocate(panelWidth, panelHeight);
+        pusher.begin(stagingPixels);
+        return allocated;
+    }
+
+    Surface &surface() override { return fb; }
+    int width() const override { return panelWidth; }
+    int height() const override { return panelHeight; }
+    uint32_t present(const Rect &r) override { return pusher.push(fb, r, mask()); }
+    const RoundMask *mask() const override { return ROUND_GLASS_MASK ? &glass : nullptr; }
+
+    const DmaPusher::Stats &pushStats() const { return pusher.stats(); }
+};
+
+#endif // GFX_PANEL_TARGET_H
@@ -0,0 +1,97 @@
+#ifndef GFX_PIXEL_LAYER_H
+#define GFX_PIXEL_LAYER_H
+
+#include <stdint.h>
+#include <string.h>
+#include "gfx/DirtyRegion.h"
+#include "gfx/RoundMask.h"
+#include "gfx/Surface.h"
+
+// Sparse, pre-rasterized layer: the non-background pixels of a drawing,
+// captured once from a surface as horizontal runs of pixels and composited
+// back with plain copies. Storage is fixed; a capture that does not fit fails
+// and leaves the layer empty so the caller can keep drawing directly.
+template <int MaxRuns, int MaxPixels>
+class PixelLayer
+{
+private:
+    struct Run
+    {
+        uint8_t x, y, len;
+        uint16_t first; // Index of the run's first pixel in pixels[]
+    };
+
+    Run runs[MaxRuns];
+    uint16_t pixels[MaxPixels];
+    int runCount = 0;
+    int pixelCount = 0;
+    bool overflow = false;
+
+public:
+    static constexpr uint32_t bytes = sizeof(Run) * MaxRuns + sizeof(uint16_t) * MaxPixels;
+
+    void clear()
+    {
+        runCount = pixelCount = 0;
+        overflow = false;
+    }
+
+    // Appends the pixels of box that differ from background, given in panel
+    // order as the surface holds it. With a mask, pixels outside the glass
+    // are left out, so composites never reach them.
+    bool capture(const Surface &fb, const Rect &box, uint16_t background, const RoundMask *mask = nullptr)
+    {
+        uint16_t row[RoundMask::maxSize];
+        Rect area = box.clipped(fb.width() < RoundMask::maxSize ? fb.width() : RoundMask::maxSize, fb.height());
+        for (int y = area.y; y < area.bottom() && !overflow; y++)
+        {
+            int x0 = area.x, x1 = area.right();
+            if (mask)
+                mask->clamp(y, x0, x1);
+            if (x0 >= x1)
+                continue;
+            fb.readRow(y, x0, x1 - x0, row);
+            for (int x = x0; x < x1; x++)
+            {
+                if (row[x - x0] == background)
+                    continue;
+
+                int end = x;
+                while (end < x1 && row[end - x0] != background)
+                    end++;
+                if (runCount == MaxRuns || pixelCount + (end - x) > MaxPixels)
+                {
+                    overflow = true;
+                    break;
+                }
+                runs[runCount++] = {(uint8_t)x, (uint8_t)y, (uint8_t)(end - x), (uint16_t)pixelCount};
+                memcpy(pixels + pixelCount, row + (x - x0), (end - x) * sizeof(uint16_t));
+                pixelCount += end - x;
+                x = end;
+            }
+        }
+        if (overflow)
+            runCount = pixelCount = 0;
+        return !overflow;
+    }
+
+    // Copies the part of the layer inside clip onto the surface
+    void draw(Surface &fb, const Rect &clip) const
+    {
+        for (int i = 0; i < runCount; i++)
+        {
+            const Run &run = runs[i];
+            if (run.y < clip.y || run.y >= clip.bottom())
+                continue;
+            int from = run.x > clip.x ? run.x : clip.x;
+            int to = run.x + run.len < clip.right() ? run.x + run.len : clip.right();
+            if (from < to)
+                fb.copy(run.y, from, pixels + run.first + (from - run.x), to - from);
+        }
+    }
+
+    bool ready() const { return runCount > 0; }
+    int size() const { return pixelCount; }
+};
+
+#endif // GFX_PIXEL_LAYER_H
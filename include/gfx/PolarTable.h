@@ -0,0 +1,73 @@
+#ifndef GFX_POLAR_TABLE_H
+#define GFX_POLAR_TABLE_H
+
+#include <stdint.h>
+
+// Point in 1/16 pixel units (Q4)
+struct FixedPoint
+{
+    int16_t x, y;
+
+    constexpr int pixelX() const { return x >> 4; } // Floor
+    constexpr int pixelY() const { return y >> 4; }
+    float toX() const { return x * (1.0f / 16); }
+    float toY() const { return y * (1.0f / 16); }
+};
+
+// Points on a circle, generated by the compiler and kept in flash. Angles are
+// in steps of 1/StepsPerDegree degree, 0 at three o'clock and increasing
+// clockwise (screen y points down). Only a quarter wave is stored; the other
+// three quarters are its mirror images.
+template <int Radius, int CentreX, int CentreY, int StepsPerDegree = 8>
+class PolarTable
+{
+public:
+    static constexpr int steps = 360 * StepsPerDegree;
+
+private:
+    static constexpr int quarter = 90 * StepsPerDegree;
+
+    // Taylor series to x^17, exact to well below a Q4 step on [0, pi/2]
+    static constexpr double sine(double x)
+    {
+        double term = x, sum = x;
+        for (int n = 1; n <= 8; n++)
+        {
+            term *= -x * x / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    struct QuarterWave
+    {
+        int16_t v[quarter + 1];
+
+        constexpr QuarterWave() : v()
+        {
+            for (int i = 0; i <= quarter; i++)
+                v[i] = (int16_t)(Radius * 16 * sine(i * 3.14159265358979323846 / (2 * quarter)) + 0.5);
+        }
+    };
+
+    static constexpr QuarterWave wave{};
+
+    // Radius * sin(step) in Q4, step in [0, steps)
+    static constexpr int sinQ4(int step)
+    {
+        return step <= quarter       ? wave.v[step]
+               : step <= 2 * quarter ? wave.v[2 * quarter - step]
+               : step <= 3 * quarter ? -wave.v[step - 2 * quarter]
+                                     : -wave.v[steps - step];
+    }
+
+public:
+    static constexpr int wrap(int step) { return (step % steps + steps) % steps; }
+
+    static constexpr FixedPoint at(int step)
+    {
+        return {(int16_t)(CentreX * 16 + sinQ4(wrap(step + quarter))), (int16_t)(CentreY * 16 + sinQ4(wrap(step)))};
+    }
+};
+
+#endif // GFX_POLAR_TABLE_H
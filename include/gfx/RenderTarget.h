@@ -0,0 +1,28 @@
+#ifndef GFX_RENDER_TARGET_H
+#define GFX_RENDER_TARGET_H
+
+#include <stdint.h>
+#include "gfx/DirtyRegion.h"
+#include "gfx/RoundMask.h"
+#include "gfx/Surface.h"
+
+// A framebuffer and the way its contents reach the glass. Display renders
+// into surface() through a Canvas and hands each finished rectangle to
+// present(); PanelTarget streams it to the M5Dial panel, MemoryTarget keeps
+// it in RAM for the host.
+class RenderTarget
+{
+public:
+    virtual ~RenderTarget() {}
+
+    virtual bool begin() = 0;
+    virtual Surface &surface() = 0;
+    virtual int width() const = 0;
+    virtual int height() const = 0;
+    virtual uint32_t present(const Rect &r) = 0; // Returns the pixels sent
+
+    // Shape of the glass, or nullptr when every pixel is visible
+    virtual const RoundMask *mask() const { return nullptr; }
+};
+
+#endif // GFX_RENDER_TARGET_H
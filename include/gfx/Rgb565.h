@@ -0,0 +1,59 @@
+#ifndef GFX_RGB565_H
+#define GFX_RGB565_H
+
+#include <stdint.h>
+
+inline uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// Mixes fg over bg with 5-bit precision, all three channels at once
+inline uint16_t blend565(uint8_t alpha, uint16_t fg, uint16_t bg)
+{
+    uint32_t f = (fg | (uint32_t)fg << 16) & 0x07E0F81F;
+    uint32_t b = (bg | (uint32_t)bg << 16) & 0x07E0F81F;
+    uint32_t mixed = (b + (((f - b) * ((alpha + 4) >> 3)) >> 5)) & 0x07E0F81F;
+    return (uint16_t)(mixed | mixed >> 16);
+}
+
+// blend565() over black: the background term drops out
+inline uint16_t scale565(uint8_t alpha, uint16_t fg)
+{
+    uint32_t f = (fg | (uint32_t)fg << 16) & 0x07E0F81F;
+    uint32_t scaled = ((f * ((alpha + 4) >> 3)) >> 5) & 0x07E0F81F;
+    return (uint16_t)(scaled | scaled >> 16);
+}
+
+#ifndef SWAP_STATS
+#define SWAP_STATS 0 // 1 counts pixels byte swapped on the CPU; 0 compiles the count out
+#endif
+
+// The panel takes each pixel high byte first. Surfaces, layers and atlases
+// hold pixels in that order, so a push is a plain copy; colours are
+// converted once, where they enter the renderer, and only those
+// conversions and glyph atlas builds are counted.
+#if SWAP_STATS
+inline uint32_t &swapCount()
+{
+    static uint32_t count = 0;
+    return count;
+}
+
+inline uint32_t byteSwaps() { return swapCount(); }
+inline void countSwaps(uint32_t pixels) { swapCount() += pixels; }
+#else
+inline uint32_t byteSwaps() { return 0; }
+inline void countSwaps(uint32_t) {}
+#endif
+
+inline uint16_t toPanel565(uint16_t rgb)
+{
+    countSwaps(1);
+    return (uint16_t)(rgb << 8 | rgb >> 8);
+}
+
+// Back to RGB565, to compare colours rather than draw them; not counted
+inline uint16_t fromPanel565(uint16_t pixel) { return (uint16_t)(pixel << 8 | pixel >> 8); }
+
+#endif // GFX_RGB565_H
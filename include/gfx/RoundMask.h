@@ -0,0 +1,69 @@
+#ifndef GFX_ROUND_MASK_H
+#define GFX_ROUND_MASK_H
+
+#include <math.h>
+#include <stdint.h>
+#include "gfx/DirtyRegion.h"
+
+#ifndef ROUND_GLASS_MASK
+#define ROUND_GLASS_MASK 1 // Set to 0 to clear and push the full square
+#endif
+
+// Visible span of every row of a round panel. Pixels outside the glass are
+// never cleared or sent, which on a circle is about 21% of the square.
+class RoundMask
+{
+public:
+    static constexpr int maxSize = 240;
+
+private:
+    uint8_t left[maxSize];
+    uint8_t right[maxSize]; // Exclusive
+    int size;
+
+public:
+    // Every pixel the circle touches counts as visible, so anti-aliased
+    // edges drawn at the rim are kept
+    explicit RoundMask(int diameter = maxSize) : size(diameter)
+    {
+        float radius = diameter / 2.0f;
+        for (int y = 0; y < size; y++)
+        {
+            float dy = fminf(fabsf(y - radius), fabsf(y + 1 - radius));
+            if (y < radius && y + 1 > radius)
+                dy = 0.0f;
+            float half = sqrtf(radius * radius - dy * dy);
+            left[y] = (uint8_t)floorf(radius - half);
+            right[y] = (uint8_t)ceilf(radius + half);
+        }
+    }
+
+    // Narrows [x0, x1) on row y to the glass; x0 >= x1 afterwards means nothing is visible
+    void clamp(int y, int &x0, int &x1) const
+    {
+        if (y < 0 || y >= size)
+        {
+            x1 = x0;
+            return;
+        }
+        if (x0 < left[y])
+            x0 = left[y];
+        if (x1 > right[y])
+            x1 = right[y];
+    }
+
+    int32_t visibleArea(const Rect &r) const
+    {
+        int32_t total = 0;
+        for (int y = r.y; y < r.bottom(); y++)
+        {
+            int x0 = r.x, x1 = r.right();
+            clamp(y, x0, x1);
+            if (x0 < x1)
+                total += x1 - x0;
+        }
+        return total;
+    }
+};
+
+#endif // GFX_ROUND_MASK_H
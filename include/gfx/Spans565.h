@@ -0,0 +1,227 @@
+#ifndef GFX_SPANS565_H
+#define GFX_SPANS565_H
+
+#include <stdint.h>
+#include <string.h>
+#include "gfx/Rgb565.h"
+
+#ifndef PIE_SPANS
+#define PIE_SPANS 0 // 1 fills and copies with the ESP32-S3's 128-bit PIE stores
+#endif
+
+// Kernels over runs of RGB565 pixels: fill, copy, byte swap, and blending
+// one colour over a span through per-pixel alpha. Every implementation must
+// give exactly the pixels of ScalarSpans; spansMatch() below checks that.
+
+// One pixel at a time, the reference
+struct ScalarSpans
+{
+    static void fill(uint16_t *dst, uint16_t color, int n)
+    {
+        for (int i = 0; i < n; i++)
+            dst[i] = color;
+    }
+
+    static void copy(uint16_t *dst, const uint16_t *src, int n)
+    {
+        for (int i = 0; i < n; i++)
+            dst[i] = src[i];
+    }
+
+    // To and from the panel's big-endian byte order; dst may be src
+    static void swapBytes(uint16_t *dst, const uint16_t *src, int n)
+    {
+        for (int i = 0; i < n; i++)
+            dst[i] = (uint16_t)(src[i] << 8 | src[i] >> 8);
+    }
+
+    static void blend(uint16_t *dst, const uint8_t *alpha, uint16_t fg, int n)
+    {
+        for (int i = 0; i < n; i++)
+            dst[i] = blend565(alpha[i], fg, dst[i]);
+    }
+};
+
+// Two pixels per 32-bit word, which any target does well
+struct SwarSpans
+{
+    static void fill(uint16_t *dst, uint16_t color, int n)
+    {
+        if (n <= 0)
+            return;
+        if ((uintptr_t)dst & 2)
+        {
+            *dst++ = color;
+            n--;
+        }
+        uint32_t pair = color | (uint32_t)color << 16;
+        for (int i = 0; i + 2 <= n; i += 2)
+            memcpy(dst + i, &pair, sizeof(pair)); // One aligned word store
+        if (n & 1)
+            dst[n - 1] = color;
+    }
+
+    static void copy(uint16_t *dst, const uint16_t *src, int n) { memcpy(dst, src, n * sizeof(uint16_t)); }
+
+    static void swapBytes(uint16_t *dst, const uint16_t *src, int n)
+    {
+        int i = 0;
+        if (!(((uintptr_t)dst ^ (uintptr_t)src) & 2))
+        {
+            if (n > 0 && ((uintptr_t)dst & 2))
+            {
+                dst[0] = (uint16_t)(src[0] << 8 | src[0] >> 8);
+                i = 1;
+            }
+            for (; i + 2 <= n; i += 2)
+            {
+                uint32_t w;
+                memcpy(&w, src + i, sizeof(w));
+                w = (w & 0x00FF00FF) << 8 | (w >> 8 & 0x00FF00FF);
+                memcpy(dst + i, &w, sizeof(w));
+            }
+        }
+        for (; i < n; i++)
+            dst[i] = (uint16_t)(src[i] << 8 | src[i] >> 8);
+    }
+
+    // Glyph rows are mostly empty or solid, and those need no arithmetic:
+    // blend565() gives dst at alpha 0 and fg at 255
+    static void blend(uint16_t *dst, const uint8_t *alpha, uint16_t fg, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            uint8_t a = alpha[i];
+            if (a == 255)
+                dst[i] = fg;
+            else if (a)
+                dst[i] = blend565(a, fg, dst[i]);
+        }
+    }
+};
+
+#if PIE_SPANS && defined(CONFIG_IDF_TARGET_ESP32S3)
+
+// Eight pixels per 128-bit store. The PIE loads and stores ignore the low
+// four address bits, so the vector loops only run on 16-byte aligned
+// pointers; the ends, and copies whose source and destination are aligned
+// differently, go through SwarSpans. Clearing vectors, as setup() does
+// when spansMatch() finds these wrong, sends everything there.
+struct PieSpans : SwarSpans
+{
+    static inline bool vectors = true;
+
+    static void fill(uint16_t *dst, uint16_t color, int n)
+    {
+        int head = (-(uintptr_t)dst & 15) / 2;
+        if (!vectors || n < head + 8)
+        {
+            SwarSpans::fill(dst, color, n);
+            return;
+        }
+        SwarSpans::fill(dst, color, head);
+        dst += head;
+        n -= head;
+
+        int blocks = n / 8;
+        asm volatile("ee.vldbc.16 q0, %[color]\n"
+                     "loopnez %[blocks], 1f\n"
+                     "ee.vst.128.ip q0, %[dst], 16\n"
+                     "1:\n"
+                     : [dst] "+r"(dst)
+                     : [color] "r"(&color), [blocks] "r"(blocks)
+                     : "memory");
+        SwarSpans::fill(dst, color, n & 7);
+    }
+
+    static void copy(uint16_t *dst, const uint16_t *src, int n)
+    {
+        int head = (-(uintptr_t)dst & 15) / 2;
+        if (!vectors || n < head + 8 || (((uintptr_t)dst ^ (uintptr_t)src) & 15))
+        {
+            SwarSpans::copy(dst, src, n);
+            return;
+        }
+        SwarSpans::copy(dst, src, head);
+        dst += head;
+        src += head;
+        n -= head;
+
+        int blocks = n / 8;
+        asm volatile("loopnez %[blocks], 1f\n"
+                     "ee.vld.128.ip q0, %[src], 16\n"
+                     "ee.vst.128.ip q0, %[dst], 16\n"
+                     "1:\n"
+                     : [dst] "+r"(dst), [src] "+r"(src)
+                     : [blocks] "r"(blocks)
+                     : "memory");
+        SwarSpans::copy(dst, src, n & 7);
+    }
+};
+
+typedef PieSpans Spans;
+
+#else
+
+typedef SwarSpans Spans;
+
+#endif
+
+// Runs every kernel of Fast and of ScalarSpans over the same pseudo-random
+// spans, at every alignment and every short length, and compares the
+// pixels. scratch holds 4 * (maxLength + 16) pixels and is 16-byte aligned.
+template <class Fast>
+bool spansMatch(uint16_t *scratch, int maxLength, uint32_t seed = 1)
+{
+    int stride = (maxLength + 15) & ~7;
+    uint16_t *src = scratch, *expected = scratch + stride, *actual = scratch + 2 * stride;
+    uint8_t *alpha = (uint8_t *)(scratch + 3 * stride);
+    auto next = [&seed]()
+    {
+        seed = seed * 1664525 + 1013904223;
+        return seed >> 16;
+    };
+
+    for (int n = 0; n <= maxLength; n = n < 40 ? n + 1 : n * 3 / 2)
+        for (int offset = 0; offset < 8; offset++)
+        {
+            for (int i = 0; i < stride; i++)
+            {
+                src[i] = next();
+                expected[i] = actual[i] = next();
+                uint32_t r = next() & 3; // Mostly empty and solid pixels, as in a glyph
+                alpha[i] = r == 0 ? 0 : r == 1 ? 255 : next();
+            }
+            uint16_t color = next();
+            int from = next() & 7; // Source misaligned against the destination
+
+            for (int kernel = 0; kernel < 4; kernel++)
+            {
+                uint16_t *e = expected + offset, *a = actual + offset;
+                switch (kernel)
+                {
+                case 0:
+                    ScalarSpans::fill(e, color, n);
+                    Fast::fill(a, color, n);
+                    break;
+                case 1:
+                    ScalarSpans::copy(e, src + from, n);
+                    Fast::copy(a, src + from, n);
+                    break;
+                case 2:
+                    ScalarSpans::swapBytes(e, src + from, n);
+                    Fast::swapBytes(a, src + from, n);
+                    break;
+                case 3:
+                    ScalarSpans::blend(e, alpha + from, color, n);
+                    Fast::blend(a, alpha + from, color, n);
+                    break;
+                }
+                if (memcmp(expected, actual, stride * sizeof(uint16_t)) != 0)
+                    return false;
+            }
+        }
+    return true;
+}
+
+#endif // GFX_SPANS565_H
@@ -0,0 +1,198 @@
+#ifndef GFX_SURFACE_H
+#define GFX_SURFACE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gfx/Spans565.h"
+
+#ifndef INDEXED_FRAMEBUFFER
+#define INDEXED_FRAMEBUFFER 0 // 1 stores the framebuffer as 4 bpp palette indices
+#endif
+
+// Pixel storage behind a RenderTarget. Pixels going in and out are always
+// RGB565 in panel byte order (see toPanel565()); how they are kept is up to
+// the surface. readRow() is what a push reads, so a surface that does not
+// hold whole pixels expands on the way out.
+
+// One pixel per uint16_t, 115 KB at 240x240
+class Rgb565Surface
+{
+private:
+    uint16_t *fb = nullptr;
+    int w = 0;
+    int h = 0;
+
+public:
+    Rgb565Surface() = default;
+    Rgb565Surface(const Rgb565Surface &) = delete;
+    Rgb565Surface &operator=(const Rgb565Surface &) = delete;
+    ~Rgb565Surface() { free(fb); }
+
+    bool allocate(int width, int height)
+    {
+        free(fb);
+        fb = (uint16_t *)calloc(width * height, sizeof(uint16_t));
+        w = fb ? width : 0;
+        h = fb ? height : 0;
+        return fb != nullptr;
+    }
+
+    int width() const { return w; }
+    int height() const { return h; }
+    uint32_t bytes() const { return (uint32_t)w * h * sizeof(uint16_t); }
+
+    void setPalette(const uint16_t *, int) {} // Direct colour
+
+    uint16_t get(int x, int y) const { return fb[y * w + x]; }
+    void set(int x, int y, uint16_t color) { fb[y * w + x] = color; }
+
+    // [x0, x1) of row y
+    void fill(int y, int x0, int x1, uint16_t color) { Spans::fill(fb + y * w + x0, color, x1 - x0); }
+    void copy(int y, int x, const uint16_t *src, int n) { Spans::copy(fb + y * w + x, src, n); }
+    void readRow(int y, int x, int n, uint16_t *dst) const { Spans::copy(dst, fb + y * w + x, n); }
+};
+
+// Two pixels per byte as indices into a 16 colour palette, 29 KB at 240x240.
+// Even columns sit in the low nibble. Colours that are not in the palette,
+// such as anti-aliased edges, are stored as the nearest entry, so a palette
+// should carry ramps of the colours drawn towards the background.
+class Indexed4Surface
+{
+public:
+    static constexpr int colors = 16;
+
+private:
+    uint8_t *fb = nullptr;
+    int w = 0;
+    int h = 0;
+    int stride = 0; // Bytes per row
+    uint16_t palette[colors] = {}; // Panel order
+    uint16_t rgb[colors] = {};     // The same colours as RGB565, for the search
+    uint32_t pairs[256]; // Both pixels of a byte, expanded, for readRow()
+
+    // Direct-mapped cache for indexOf(): anti-aliased edges repeat the same
+    // few blends, so the nearest-colour search runs about once per blend
+    static constexpr int cacheSize = 64;
+    uint16_t cachedColor[cacheSize];
+    uint8_t cachedIndex[cacheSize];
+
+    uint8_t indexOf(uint16_t color)
+    {
+        int slot = (color ^ color >> 6 ^ color >> 11) & (cacheSize - 1);
+        if (cachedColor[slot] == color)
+            return cachedIndex[slot];
+
+        // Nearest by squared distance with every channel scaled to 5 bits
+        uint16_t c = fromPanel565(color);
+        int r = c >> 11, g = (c >> 6) & 31, b = c & 31;
+        int best = 0, bestDistance = 1 << 30;
+        for (int i = 0; i < colors && bestDistance; i++)
+        {
+            int dr = r - (rgb[i] >> 11), dg = g - ((rgb[i] >> 6) & 31), db = b - (rgb[i] & 31);
+            int distance = dr * dr + dg * dg + db * db;
+            if (distance < bestDistance)
+            {
+                best = i;
+                bestDistance = distance;
+            }
+        }
+        cachedColor[slot] = color;
+        cachedIndex[slot] = best;
+        return best;
+    }
+
+public:
+    Indexed4Surface() { setPalette(nullptr, 0); }
+    Indexed4Surface(const Indexed4Surface &) = delete;
+    Indexed4Surface &operator=(const Indexed4Surface &) = delete;
+    ~Indexed4Surface() { free(fb); }
+
+    bool allocate(int width, int height)
+    {
+        free(fb);
+        stride = (width + 1) / 2;
+        fb = (uint8_t *)calloc(stride * height, 1);
+        w = fb ? width : 0;
+        h = fb ? height : 0;
+        return fb != nullptr;
+    }
+
+    int width() const { return w; }
+    int height() const { return h; }
+    uint32_t bytes() const { return (uint32_t)stride * h; }
+
+    // Unused entries repeat the first. Pixels keep their indices, so a new
+    // palette recolours whatever is already drawn.
+    void setPalette(const uint16_t *entries, int n)
+    {
+        for (int i = 0; i < colors; i++)
+        {
+            palette[i] = i < n ? entries[i] : (n ? entries[0] : 0);
+            rgb[i] = fromPanel565(palette[i]);
+        }
+        for (int b = 0; b < 256; b++)
+            pairs[b] = palette[b & 15] | (uint32_t)palette[b >> 4] << 16;
+        for (int i = 0; i < cacheSize; i++)
+        {
+            cachedColor[i] = palette[0];
+            cachedIndex[i] = 0;
+        }
+    }
+
+    uint16_t get(int x, int y) const
+    {
+        uint8_t byte = fb[y * stride + x / 2];
+        return palette[x & 1 ? byte >> 4 : byte & 15];
+    }
+
+    void set(int x, int y, uint16_t color)
+    {
+        uint8_t &byte = fb[y * stride + x / 2];
+        uint8_t i = indexOf(color);
+        byte = x & 1 ? (byte & 0x0F) | i << 4 : (byte & 0xF0) | i;
+    }
+
+    void fill(int y, int x0, int x1, uint16_t color)
+    {
+        if (x0 >= x1)
+            return;
+        uint8_t i = indexOf(color);
+        if (x0 & 1)
+            set(x0++, y, color);
+        if (x1 & 1 && x0 < x1)
+            set(--x1, y, color);
+        memset(fb + y * stride + x0 / 2, i | i << 4, (x1 - x0) / 2);
+    }
+
+    void copy(int y, int x, const uint16_t *src, int n)
+    {
+        for (int i = 0; i < n; i++)
+            set(x + i, y, src[i]);
+    }
+
+    // Expands a byte, two pixels, per lookup
+    void readRow(int y, int x, int n, uint16_t *dst) const
+    {
+        const uint8_t *row = fb + y * stride;
+        if (n > 0 && x & 1)
+        {
+            *dst++ = palette[row[x / 2] >> 4];
+            x++;
+            n--;
+        }
+        const uint8_t *src = row + x / 2;
+        for (; n >= 2; n -= 2, dst += 2)
+            memcpy(dst, &pairs[*src++], sizeof(uint32_t));
+        if (n > 0)
+            *dst = palette[*src & 15];
+    }
+};
+
+#if INDEXED_FRAMEBUFFER
+typedef Indexed4Surface Surface;
+#else
+typedef Rgb565Surface Surface;
+#endif
+
+#endif // GFX_SURFACE_H
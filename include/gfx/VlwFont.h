@@ -0,0 +1,156 @@
+#ifndef GFX_VLW_FONT_H
+#define GFX_VLW_FONT_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Anti-aliased font in the Processing .vlw format, read straight from the
+// byte arrays in include/fonts. The file is a 24 byte header, a 28 byte
+// metrics record per glyph (all big-endian int32) and then the 8-bit alpha
+// bitmaps in glyph order.
+//
+// Packed fonts, made by tools/packfont.py, start with "PVLW", carry their
+// glyph table ready to use and code each bitmap as 4-bit alpha runs (see
+// GlyphRuns). Loading one allocates nothing.
+class VlwFont
+{
+public:
+    struct Glyph
+    {
+        uint16_t code;
+        uint8_t width;
+        uint8_t height;
+        uint8_t xAdvance;
+        int8_t dX;     // Left side bearing
+        int16_t dY;    // Distance from the baseline up to the top row
+        uint32_t data; // Offset of the bitmap from the start of the file
+    };
+
+private:
+    const uint8_t *file = nullptr;
+    const Glyph *glyphs = nullptr;
+    bool owned = false; // Glyph table parsed into the heap
+    int count = 0;
+    int maxAscent = 0;
+    int maxDescent = 0;
+    int space = 0;
+
+    static int32_t readInt32(const uint8_t *p)
+    {
+        return (int32_t)((uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3]);
+    }
+
+    // Header of four little-endian uint16: glyphs, ascent, descent, space
+    bool loadPacked(const uint8_t *packed)
+    {
+        static_assert(sizeof(Glyph) == 12, "packed fonts store VlwFont::Glyph as is");
+        uint16_t header[4];
+        memcpy(header, packed + 4, sizeof(header));
+        file = packed;
+        glyphs = (const Glyph *)(packed + 12);
+        count = header[0];
+        maxAscent = header[1];
+        maxDescent = header[2];
+        space = header[3];
+        return true;
+    }
+
+public:
+    VlwFont() = default;
+    VlwFont(const VlwFont &) = delete; // Owns its glyph table
+    VlwFont &operator=(const VlwFont &) = delete;
+    ~VlwFont() { unload(); }
+
+    // Glyph tables allocated by every font so far. Parsing belongs in
+    // begin(), so this should not move once the clock is running.
+    static uint32_t &allocations()
+    {
+        static uint32_t count = 0;
+        return count;
+    }
+
+    bool load(const uint8_t *vlw)
+    {
+        unload();
+        if (!memcmp(vlw, "PVLW", 4))
+            return loadPacked(vlw);
+
+        int n = readInt32(vlw);
+        Glyph *table = (Glyph *)malloc(n * sizeof(Glyph));
+        if (!table)
+            return false;
+        allocations()++;
+
+        file = vlw;
+        glyphs = table;
+        owned = true;
+        count = n;
+        int ascent = readInt32(vlw + 16);
+        int descent = readInt32(vlw + 20);
+
+        uint32_t data = 24 + 28 * n;
+        for (int i = 0; i < n; i++)
+        {
+            const uint8_t *m = vlw + 24 + 28 * i;
+            Glyph &g = table[i];
+            g.code = readInt32(m);
+            g.height = readInt32(m + 4);
+            g.width = readInt32(m + 8);
+            g.xAdvance = readInt32(m + 12);
+            g.dY = readInt32(m + 16);
+            g.dX = readInt32(m + 20);
+            g.data = data;
+            data += g.width * g.height;
+
+            // Latin-1 supplement glyphs carry odd metrics (e.g. the 100 px tall
+            // no-break space), so they do not count towards the line height
+            if (g.code >= 0xA0 && g.code <= 0xFF)
+                continue;
+            if (g.dY > maxAscent)
+                maxAscent = g.dY;
+            if (g.height - g.dY > maxDescent)
+                maxDescent = g.height - g.dY;
+        }
+        space = (ascent + descent) * 2 / 7;
+        return true;
+    }
+
+    void unload()
+    {
+        if (owned)
+            free((void *)glyphs);
+        glyphs = nullptr;
+        owned = false;
+        file = nullptr;
+        count = maxAscent = maxDescent = space = 0;
+    }
+
+    // Glyphs are stored in ascending code order
+    const Glyph *find(uint16_t code) const
+    {
+        int lo = 0, hi = count - 1;
+        while (lo <= hi)
+        {
+            int mid = (lo + hi) / 2;
+            if (glyphs[mid].code == code)
+                return &glyphs[mid];
+            if (glyphs[mid].code < code)
+                lo = mid + 1;
+            else
+                hi = mid - 1;
+        }
+        return nullptr;
+    }
+
+    // 8-bit alpha, or for a packed font the glyph's run stream
+    const uint8_t *bitmap(const Glyph &g) const { return file + g.data; }
+
+    bool loaded() const { return file != nullptr; }
+    bool packed() const { return loaded() && !owned; }
+    int ascent() const { return maxAscent; }
+    int height() const { return maxAscent + maxDescent; }
+    int spaceWidth() const { return space; }
+};
+
+#endif // GFX_VLW_FONT_H
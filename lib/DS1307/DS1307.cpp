@@ -5,7 +5,11 @@
     Copyright (c) 2013 seeed technology inc.
     Author        :   FrankieChu
     Create Time   :   Jan 2013
-    Change Log    :
+    Change Log    :   Time and control registers read in one burst; getRam()
+                      and setRam() cover all 56 bytes; requests can run on a
+                      worker task and finish through a callback; part of
+                      the RAM can be written on its own; transfers go
+                      through an I2cBus shared with other devices
 
     The MIT License (MIT)
 
@@ -28,19 +32,13 @@
     THE SOFTWARE.
 */
 
-#include <Wire.h>
+#include <esp_timer.h>
+#include <string.h>
 #include "DS1307.h"
 
 DS1307::DS1307() {
-    begin(); // Default initialization
 }
 
-#ifndef Arduino_h
-DS1307::DS1307(uint16_t SDA, uint16_t SCL) {
-    begin(SDA, SCL); // Initialize with specified pins
-}
-#endif
-
 uint8_t DS1307::decToBcd(uint8_t val) {
     return ((val / 10 * 16) + (val % 10));
 }
@@ -51,79 +49,113 @@ uint8_t DS1307::bcdToDec(uint8_t val) {
 }
 
 /**
- * \brief          Start the I2C port
+ * \brief          Use an I2C bus the caller has started, whose task runs
+ *                 the Async requests
+ *
+ * \param i2c      The bus the DS1307 is on
+ *
  */
-void DS1307::begin() {
-    Wire.begin();
+void DS1307::begin(I2cBus &i2c) {
+    bus = &i2c;
 }
 
-#ifndef Arduino_h
 /**
- * \brief          The function to start the I2C port with specified pins
- *                 
- * \param SDA      The pin number which is used as SDA pin
- * \param SCL      The pin number which is used as SCL pin
- *
+ * \brief          Read registers in one transaction: the register pointer
+ *                 write and the read are joined by a repeated start
  */
-void DS1307::begin(uint16_t SDA ,uint16_t SCL) {
-    Wire.begin(SDA,SCL);
+bool DS1307::readRegisters(uint8_t first, uint8_t *data, uint8_t count) {
+    I2cBus::Transfer transfer;
+    transfer.address = DS1307_I2C_ADDRESS;
+    transfer.data[0] = first;
+    transfer.writeLength = 1;
+    transfer.readLength = count;
+    if (!bus || !bus->transfer(transfer)) {
+        return false;
+    }
+    memcpy(data, transfer.data, count);
+    return true;
+}
+
+/**
+ * \brief          Write registers from first on in one transaction. The
+ *                 whole RAM is 57 bytes with the address, within
+ *                 I2C_BUS_MAX_DATA.
+ */
+bool DS1307::writeRegisters(uint8_t first, const uint8_t *data, uint8_t count) {
+    I2cBus::Transfer transfer;
+    transfer.address = DS1307_I2C_ADDRESS;
+    transfer.data[0] = first;
+    memcpy(transfer.data + 1, data, count);
+    transfer.writeLength = count + 1;
+    return bus && bus->transfer(transfer);
+}
+
+// Registers 0x00-0x06 from the fields; 0 to bit 7 of the seconds starts the clock
+void DS1307::encodeTime(uint8_t *registers) {
+    registers[0] = decToBcd(second);
+    registers[1] = decToBcd(minute);
+    registers[2] = decToBcd(hour);  // If you want 12 hour am/pm you need to set bit 6
+    registers[3] = decToBcd(dayOfWeek);
+    registers[4] = decToBcd(dayOfMonth);
+    registers[5] = decToBcd(month);
+    registers[6] = decToBcd(year);
+}
+
+// The fields from registers 0x00-0x07
+void DS1307::decodeTime(const uint8_t *registers) {
+    // A few of these need masks because certain bits are control bits
+    halted     = registers[0] & 0x80;
+    second     = bcdToDec(registers[0] & 0x7f);
+    minute     = bcdToDec(registers[1]);
+    hour       = bcdToDec(registers[2] & 0x3f);// Need to change this if 12 hour am/pm
+    dayOfWeek  = bcdToDec(registers[3]);
+    dayOfMonth = bcdToDec(registers[4]);
+    month      = bcdToDec(registers[5]);
+    year       = bcdToDec(registers[6]);
+    control    = registers[7];
 }
-#endif
 
 /*Function: The clock timing will start */
 void DS1307::startClock(void) {      // set the ClockHalt bit low to start the rtc
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);                      // Register 0x00 holds the oscillator start/stop bit
-    Wire.endTransmission();
-    Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
-    second = Wire.read() & 0x7f;       // save actual seconds and AND sec with bit 7 (sart/stop bit) = clock started
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);
-    Wire.write((uint8_t)second);                    // write seconds back and start the clock
-    Wire.endTransmission();
+    uint8_t seconds;
+    if (readRegisters(0x00, &seconds, 1)) { // Register 0x00 holds the oscillator start/stop bit
+        seconds &= 0x7f;
+        halted = !writeRegisters(0x00, &seconds, 1);
+    }
 }
 /*Function: The clock timing will stop */
 void DS1307::stopClock(void) {       // set the ClockHalt bit high to stop the rtc
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);                      // Register 0x00 holds the oscillator start/stop bit
-    Wire.endTransmission();
-    Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
-    second = Wire.read() | 0x80;       // save actual seconds and OR sec with bit 7 (sart/stop bit) = clock stopped
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);
-    Wire.write((uint8_t)second);                    // write seconds back and stop the clock
-    Wire.endTransmission();
+    uint8_t seconds;
+    if (readRegisters(0x00, &seconds, 1)) {
+        seconds |= 0x80;
+        halted = writeRegisters(0x00, &seconds, 1);
+    }
 }
 /****************************************************************/
-/*Function: Read time and date from RTC */
-void DS1307::getTime() {
-    // Reset the register pointer
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);
-    Wire.endTransmission();
-    Wire.requestFrom(DS1307_I2C_ADDRESS, 7);
-    // A few of these need masks because certain bits are control bits
-    second     = bcdToDec(Wire.read() & 0x7f);
-    minute     = bcdToDec(Wire.read());
-    hour       = bcdToDec(Wire.read() & 0x3f);// Need to change this if 12 hour am/pm
-    dayOfWeek  = bcdToDec(Wire.read());
-    dayOfMonth = bcdToDec(Wire.read());
-    month      = bcdToDec(Wire.read());
-    year       = bcdToDec(Wire.read());
+/*Function: Read time and date, the clock halt bit and the SQW setting
+  from the RTC in one burst; false if it did not answer */
+bool DS1307::getTime() {
+    uint8_t registers[8];
+    int64_t at = esp_timer_get_time();
+    if (!readRegisters(0x00, registers, sizeof(registers))) {
+        failures++;
+        return false;
+    }
+    timeMicros = at;
+    decodeTime(registers);
+    return true;
 }
 /*******************************************************************/
-/*Function: Write the time that includes the date to the RTC chip */
-void DS1307::setTime() {
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);
-    Wire.write(decToBcd(second));// 0 to bit 7 starts the clock
-    Wire.write(decToBcd(minute));
-    Wire.write(decToBcd(hour));  // If you want 12 hour am/pm you need to set bit 6
-    Wire.write(decToBcd(dayOfWeek));
-    Wire.write(decToBcd(dayOfMonth));
-    Wire.write(decToBcd(month));
-    Wire.write(decToBcd(year));
-    Wire.endTransmission();
+/*Function: Write the time that includes the date to the RTC chip; false
+  if it did not answer */
+bool DS1307::setTime() {
+    uint8_t registers[7];
+    encodeTime(registers);
+    if (!writeRegisters(0x00, registers, sizeof(registers))) {
+        failures++;
+        return false;
+    }
+    return true;
 }
 
 /**
@@ -173,26 +205,15 @@ void DS1307::fillDayOfWeek(uint8_t _dow) {
  *
  */
 void DS1307::setRamAddress(uint8_t _addr, uint8_t _value) {
-    uint8_t address = _addr + DS1307_RAM_OFFSET;
-
     ram[_addr] = _value;
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write(address);
-    Wire.write(_value);
-    Wire.endTransmission();
-
+    writeRegisters(_addr + DS1307_RAM_OFFSET, &_value, 1);
 }
 
 /**
  * \brief          Save the contents of the RAM buffer to the DS1307
  */
 void DS1307::setRam(){
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write(0x08);
-    for (uint8_t pos = 0; pos < 55; ++pos) {
-        Wire.write(ram[pos]);
-    }
-    Wire.endTransmission();
+    writeRegisters(DS1307_RAM_OFFSET, ram, DS1307_RAM_SIZE);
 }
 
 /**
@@ -202,37 +223,157 @@ void DS1307::setRam(){
  *
  */
 uint8_t DS1307::getRamAddress(uint8_t _addr) {
-    uint8_t address = _addr + DS1307_RAM_OFFSET;
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write(address);
-    Wire.endTransmission();
-
-    Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
-    ram[_addr] = Wire.read();
+    readRegisters(_addr + DS1307_RAM_OFFSET, &ram[_addr], 1);
     return ram[_addr];
 }
 
 /**
- * \brief          Retrieve the contents of RAM to the ram buffer
+ * \brief          Retrieve the contents of RAM to the ram buffer; false if
+ *                 the RTC did not answer
  */
-void DS1307::getRam() {
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write(0x08);
-    Wire.endTransmission();
-
-    Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
-    for (uint8_t pos = 0; pos < 55; ++pos) {
-        ram[pos] = Wire.read();
+bool DS1307::getRam() {
+    if (!readRegisters(DS1307_RAM_OFFSET, ram, DS1307_RAM_SIZE)) {
+        failures++;
+        return false;
     }
+    return true;
 }
 
 /**
  * \brief          Returns whether or not the clock is started
  */
 bool DS1307::isStarted(){
-    Wire.beginTransmission(DS1307_I2C_ADDRESS);
-    Wire.write((uint8_t)0x00);
-    Wire.endTransmission();
-    Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
-    return !(bool)(Wire.read() & 0x80);       // bit 7 (sart/stop bit) = clock started    
+    uint8_t seconds;
+    if (!readRegisters(0x00, &seconds, 1)) {
+        return false;
+    }
+    halted = seconds & 0x80;       // bit 7 (sart/stop bit) = clock started
+    return !halted;
+}
+
+/**
+ * \brief          Set what SQW/OUT gives out
+ *
+ * \param _mode    DS1307_SQW_LOW, _HIGH, _1HZ, _4KHZ, _8KHZ or _32KHZ
+ *
+ */
+void DS1307::setSquareWave(uint8_t _mode) {
+    if (writeRegisters(DS1307_CONTROL, &_mode, 1)) {
+        control = _mode;
+    }
+}
+
+/****************************************************************/
+/* Requests that do not wait for the bus. The bus runs them, on its own
+   task on the ESP32, while loop() carries on; their results reach the
+   fields, and their callbacks run, inside poll(). */
+
+bool DS1307::submit(Operation operation, uint8_t first, uint8_t length, const uint8_t *data, Callback done,
+                    void *context) {
+    Request *request = nullptr;
+    for (uint8_t i = 0; i < DS1307_QUEUE_LENGTH && !request; ++i) {
+        if (requests[i].operation == NONE) {
+            request = &requests[i];
+        }
+    }
+    if (!bus || !request) {
+        return false;
+    }
+    I2cBus::Transfer transfer;
+    transfer.address = DS1307_I2C_ADDRESS;
+    transfer.priority = operation == GET_TIME || operation == SET_TIME ? I2cBus::URGENT : I2cBus::BACKGROUND;
+    transfer.done = finish;
+    transfer.context = request;
+    transfer.data[0] = first;
+    if (data) {
+        memcpy(transfer.data + 1, data, length);
+        transfer.writeLength = length + 1;
+    } else {
+        transfer.writeLength = 1;
+        transfer.readLength = length;
+    }
+    if (!bus->submit(transfer)) {
+        return false;
+    }
+    *request = {this, operation, first, length, done, context};
+    inFlight++;
+    return true;
+}
+
+void DS1307::finish(const I2cBus::Transfer &transfer, void *context) {
+    Request request = *(Request *)context;
+    ((Request *)context)->operation = NONE;
+    DS1307 &rtc = *request.rtc;
+    bool ok = transfer.status == I2cBus::OK;
+    rtc.inFlight--;
+    if (!ok) {
+        rtc.failures++;
+    } else if (request.operation == GET_TIME) {
+        rtc.timeMicros = transfer.startedMicros;
+        rtc.decodeTime(transfer.data);
+    } else if (request.operation == GET_RAM) {
+        memcpy(rtc.ram + request.first - DS1307_RAM_OFFSET, transfer.data, request.length);
+    }
+    if (request.done) {
+        request.done(rtc, ok, request.context);
+    }
+}
+
+/**
+ * \brief          Read time, date, clock halt and SQW setting in one burst
+ *
+ * \param done     Called from poll() once the fields hold them
+ * \param context  Passed on to done
+ *
+ */
+bool DS1307::getTimeAsync(Callback done, void *context) {
+    return submit(GET_TIME, 0x00, 8, nullptr, done, context);
+}
+
+/**
+ * \brief          Write the time in the fields now to the RTC
+ */
+bool DS1307::setTimeAsync(Callback done, void *context) {
+    uint8_t registers[7];
+    encodeTime(registers);
+    return submit(SET_TIME, 0x00, sizeof(registers), registers, done, context);
+}
+
+/**
+ * \brief          Read all of the RAM into the ram buffer
+ */
+bool DS1307::getRamAsync(Callback done, void *context) {
+    return submit(GET_RAM, DS1307_RAM_OFFSET, DS1307_RAM_SIZE, nullptr, done, context);
+}
+
+/**
+ * \brief          Write the ram buffer as it is now to the RTC
+ */
+bool DS1307::setRamAsync(Callback done, void *context) {
+    return setRamAsync(0, DS1307_RAM_SIZE, done, context);
+}
+
+/**
+ * \brief          Write part of the ram buffer as it is now to the RTC, in
+ *                 one transaction of _count + 2 bytes
+ *
+ * \param _addr    The first address (0-55)
+ * \param _count   How many bytes from there
+ *
+ */
+bool DS1307::setRamAsync(uint8_t _addr, uint8_t _count, Callback done, void *context) {
+    if (_addr + _count > DS1307_RAM_SIZE) {
+        return false;
+    }
+    return submit(SET_RAM, DS1307_RAM_OFFSET + _addr, _count, ram + _addr, done, context);
+}
+
+/**
+ * \brief          Finish the requests that are done, these and any others
+ *                 on the bus; call it from loop()
+ */
+void DS1307::poll() {
+    if (bus) {
+        bus->poll();
+    }
 }
@@ -5,7 +5,11 @@
     Copyright (c) 2013 seeed technology inc.
     Author        :   FrankieChu
     Create Time   :   Jan 2013
-    Change Log    :
+    Change Log    :   Time and control registers read in one burst; getRam()
+                      and setRam() cover all 56 bytes; requests can run on a
+                      worker task and finish through a callback; part of
+                      the RAM can be written on its own; transfers go
+                      through an I2cBus shared with other devices
 
     The MIT License (MIT)
 
@@ -32,9 +36,12 @@
 #define __DS1307_H__
 
 #include <Arduino.h>
+#include <I2cBus.h>
 
 #define DS1307_I2C_ADDRESS 0x68
 #define DS1307_RAM_OFFSET 0x08
+#define DS1307_RAM_SIZE 56
+#define DS1307_CONTROL 0x07
 
 #define MON 1
 #define TUE 2
@@ -44,32 +51,77 @@
 #define SAT 6
 #define SUN 7
 
+// Control register: SQW/OUT off (low or high), or a square wave
+#define DS1307_SQW_LOW 0x00
+#define DS1307_SQW_HIGH 0x80
+#define DS1307_SQW_1HZ 0x10
+#define DS1307_SQW_4KHZ 0x11
+#define DS1307_SQW_8KHZ 0x12
+#define DS1307_SQW_32KHZ 0x13
+
+#define DS1307_QUEUE_LENGTH 4 // Requests on the bus at once
+
 class DS1307 {
+  public:
+    // ok is false when the chip did not answer; the fields are then as they were
+    typedef void (*Callback)(DS1307 &rtc, bool ok, void *context);
+
   private:
+    enum Operation : uint8_t { NONE, GET_TIME, SET_TIME, GET_RAM, SET_RAM };
+
+    struct Request {
+        DS1307 *rtc;
+        Operation operation;
+        uint8_t first; // Register
+        uint8_t length;
+        Callback done;
+        void *context;
+    };
+
+    I2cBus *bus = nullptr;
+    Request requests[DS1307_QUEUE_LENGTH] = {}; // On the bus; NONE when free
+    uint32_t failures = 0;
+
     uint8_t decToBcd(uint8_t val);
     uint8_t bcdToDec(uint8_t val);
+    bool readRegisters(uint8_t first, uint8_t *data, uint8_t count);
+    bool writeRegisters(uint8_t first, const uint8_t *data, uint8_t count);
+    void encodeTime(uint8_t *registers);
+    void decodeTime(const uint8_t *registers);
+    bool submit(Operation operation, uint8_t first, uint8_t length, const uint8_t *data, Callback done,
+                void *context);
+    static void finish(const I2cBus::Transfer &transfer, void *context);
+    uint8_t inFlight = 0;
 
   public:
-    DS1307(); // Default constructor
-#ifndef Arduino_h
-    DS1307(uint16_t SDA, uint16_t SCL); // Constructor with pin configuration
-#endif
-    void begin();
-#ifndef Arduino_h
-    void begin(uint16_t SDA ,uint16_t SCL);
-#endif
+    DS1307(); // Default constructor; the bus is attached by begin()
+    void begin(I2cBus &i2c);
     void startClock(void);
     void stopClock(void);
-    void setTime(void);
-    void getTime(void);
+    bool setTime(void);
+    bool getTime(void);
     void fillByHMS(uint8_t _hour, uint8_t _minute, uint8_t _second);
     void fillByYMD(uint16_t _year, uint8_t _month, uint8_t _day);
     void fillDayOfWeek(uint8_t _dow);
     void setRamAddress(uint8_t _addr, uint8_t _value);
     void setRam();
     uint8_t getRamAddress(uint8_t _addr);
-    void getRam();
+    bool getRam();
     bool isStarted();
+    void setSquareWave(uint8_t _mode);
+
+    // The same requests without waiting for the bus. Each takes what it
+    // writes when it is made, and fills the fields when poll() finishes it;
+    // false when the queue is full. Time goes ahead of RAM on the bus.
+    bool getTimeAsync(Callback done, void *context = nullptr);
+    bool setTimeAsync(Callback done = nullptr, void *context = nullptr);
+    bool getRamAsync(Callback done, void *context = nullptr);
+    bool setRamAsync(Callback done = nullptr, void *context = nullptr);
+    bool setRamAsync(uint8_t _addr, uint8_t _count, Callback done = nullptr, void *context = nullptr);
+    void poll();
+    uint8_t pending() const { return inFlight; }
+    uint32_t errors() const { return failures; }
+
     uint8_t second;
     uint8_t minute;
     uint8_t hour;
@@ -77,7 +129,10 @@ class DS1307 {
     uint8_t dayOfMonth;
     uint8_t month;
     uint16_t year;
-    uint8_t ram[56];
+    bool halted = false;    // Clock halt bit: the oscillator is stopped
+    uint8_t control = 0;    // SQW/OUT setting
+    int64_t timeMicros = 0; // esp_timer time the latest time read was made
+    uint8_t ram[DS1307_RAM_SIZE];
 };
 
 #endif
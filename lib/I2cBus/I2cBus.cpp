@@ -0,0 +1,184 @@
+#include <esp_timer.h>
+#include <string.h>
+#include "I2cBus.h"
+
+void I2cBus::begin(TwoWire &port)
+{
+    wire = &port;
+    wire->setTimeOut(I2C_BUS_TIMEOUT_MS);
+#ifdef ESP32
+    if (!requests)
+    {
+        requests = xQueueCreate(I2C_BUS_QUEUE_LENGTH, sizeof(Transfer));
+        results = xQueueCreate(I2C_BUS_QUEUE_LENGTH, sizeof(Transfer));
+        lock = xSemaphoreCreateMutex();
+        xTaskCreate(worker, "i2c", 4096, this, 2, nullptr);
+    }
+#endif
+}
+
+I2cBus::Status I2cBus::exchange(Transfer &transfer)
+{
+    if (transfer.writeLength || !transfer.readLength)
+    {
+        wire->beginTransmission(transfer.address);
+        wire->write(transfer.data, transfer.writeLength);
+        switch (wire->endTransmission(transfer.readLength == 0)) // A read follows with a repeated start
+        {
+        case 0:
+            break;
+        case 2:
+        case 3:
+            return NO_ANSWER;
+        default:
+            return BUS_ERROR;
+        }
+    }
+    if (transfer.readLength)
+    {
+        if (wire->requestFrom(transfer.address, transfer.readLength) != transfer.readLength)
+            return NO_ANSWER;
+        for (uint8_t i = 0; i < transfer.readLength; i++)
+            transfer.data[i] = wire->read();
+    }
+    return OK;
+}
+
+void I2cBus::run(Transfer &transfer)
+{
+    transfer.startedMicros = esp_timer_get_time();
+    if (transfer.startedMicros - transfer.submittedMicros > transfer.timeoutMicros)
+        transfer.status = EXPIRED;
+    else
+        transfer.status = exchange(transfer);
+    transfer.finishedMicros = esp_timer_get_time();
+}
+
+// Most urgent first, in order of submitting within a priority
+void I2cBus::runBatch(Transfer *batch, int n)
+{
+    for (int i = 1; i < n; i++)
+    {
+        for (int j = i; j > 0 && batch[j].priority < batch[j - 1].priority; j--)
+        {
+            Transfer t = batch[j];
+            batch[j] = batch[j - 1];
+            batch[j - 1] = t;
+        }
+    }
+#ifdef ESP32
+    xSemaphoreTake(lock, portMAX_DELAY);
+#endif
+    for (int i = 0; i < n; i++)
+        run(batch[i]);
+#ifdef ESP32
+    xSemaphoreGive(lock);
+#endif
+}
+
+void I2cBus::record(const Transfer &transfer)
+{
+    DeviceStats *stats = nullptr;
+    for (uint8_t i = 0; i < deviceCount && !stats; i++)
+        if (devices[i].address == transfer.address)
+            stats = &devices[i];
+    if (!stats)
+    {
+        if (deviceCount == I2C_BUS_DEVICES)
+            return;
+        stats = &devices[deviceCount++];
+        stats->address = transfer.address;
+    }
+    uint32_t latency = (uint32_t)(transfer.finishedMicros - transfer.submittedMicros);
+    stats->transfers++;
+    stats->latencyMicros += latency;
+    if (latency > stats->worstMicros)
+        stats->worstMicros = latency;
+    if (transfer.status == EXPIRED)
+        stats->expired++;
+    else
+    {
+        stats->busMicros += transfer.finishedMicros - transfer.startedMicros;
+        if (transfer.status != OK)
+            stats->failures++;
+    }
+}
+
+bool I2cBus::submit(const Transfer &transfer)
+{
+    if (!wire || inFlight >= I2C_BUS_QUEUE_LENGTH)
+        return false;
+    Transfer queuedTransfer = transfer;
+    queuedTransfer.submittedMicros = esp_timer_get_time();
+#ifdef ESP32
+    if (xQueueSend(requests, &queuedTransfer, 0) != pdTRUE)
+        return false;
+#else
+    queue[queued++] = queuedTransfer;
+#endif
+    inFlight++;
+    return true;
+}
+
+bool I2cBus::transfer(Transfer &transfer)
+{
+    if (!wire)
+        return false;
+    transfer.submittedMicros = esp_timer_get_time();
+#ifdef ESP32
+    xSemaphoreTake(lock, portMAX_DELAY);
+#endif
+    run(transfer);
+#ifdef ESP32
+    xSemaphoreGive(lock);
+#endif
+    record(transfer);
+    return transfer.status == OK;
+}
+
+void I2cBus::poll()
+{
+#ifdef ESP32
+    Transfer transfer;
+    while (xQueueReceive(results, &transfer, 0) == pdTRUE)
+    {
+        inFlight--;
+        record(transfer);
+        if (transfer.done)
+            transfer.done(transfer, transfer.context);
+    }
+#else
+    // Callbacks may queue more; those wait for the next poll()
+    Transfer batch[I2C_BUS_QUEUE_LENGTH];
+    int n = queued;
+    memcpy(batch, queue, n * sizeof(Transfer));
+    queued = 0;
+    runBatch(batch, n);
+    for (int i = 0; i < n; i++)
+    {
+        inFlight--;
+        record(batch[i]);
+        if (batch[i].done)
+            batch[i].done(batch[i], batch[i].context);
+    }
+#endif
+}
+
+#ifdef ESP32
+void I2cBus::worker(void *self)
+{
+    I2cBus &bus = *(I2cBus *)self;
+    Transfer batch[I2C_BUS_QUEUE_LENGTH];
+    for (;;)
+    {
+        if (xQueueReceive(bus.requests, &batch[0], portMAX_DELAY) != pdTRUE)
+            continue;
+        int n = 1;
+        while (n < I2C_BUS_QUEUE_LENGTH && xQueueReceive(bus.requests, &batch[n], 0) == pdTRUE)
+            n++;
+        bus.runBatch(batch, n);
+        for (int i = 0; i < n; i++)
+            xQueueSend(bus.results, &batch[i], portMAX_DELAY);
+    }
+}
+#endif
@@ -0,0 +1,117 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#ifdef ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#endif
+
+#define I2C_BUS_QUEUE_LENGTH 8 // Transfers waiting for, or finished on, the bus
+#define I2C_BUS_MAX_DATA 64    // Bytes one transfer writes, or reads
+#define I2C_BUS_DEVICES 8      // Addresses stats are kept for
+#define I2C_BUS_TIMEOUT_MS 20  // A transaction the clock is held in longer fails
+
+// One I2C port shared by every driver on it. Transfers are queued and run
+// by a task of their own on the ESP32, so a slow or stuck bus holds up that
+// task and not loop(); elsewhere poll() runs them. What is queued when the
+// bus comes free runs as one batch, most urgent first and otherwise in
+// order, and a transfer that waited longer than its timeout is dropped
+// without touching the bus. Results come back, and callbacks run, inside
+// poll(). transfer() runs one at once for setup and synchronous driver
+// calls, between batches. All of it is called from the loop task.
+class I2cBus
+{
+public:
+    enum Priority : uint8_t
+    {
+        URGENT,
+        NORMAL,
+        BACKGROUND
+    };
+
+    enum Status : uint8_t
+    {
+        OK,
+        NO_ANSWER, // Address or data not acknowledged, or a short read
+        BUS_ERROR, // Timed out with the clock held low, or lost arbitration
+        EXPIRED    // Not begun within its timeout, so never sent
+    };
+
+    struct Transfer;
+    typedef void (*Callback)(const Transfer &transfer, void *context);
+
+    // Writes writeLength bytes, then reads readLength after a repeated
+    // start; either can be 0
+    struct Transfer
+    {
+        uint8_t address = 0;
+        Priority priority = NORMAL;
+        uint8_t writeLength = 0;
+        uint8_t readLength = 0;
+        uint32_t timeoutMicros = 100000; // From submitting to starting
+        Callback done = nullptr;
+        void *context = nullptr;
+        uint8_t data[I2C_BUS_MAX_DATA]; // What is written, replaced by what is read
+
+        // Set by the bus; esp_timer times
+        Status status = OK;
+        int64_t submittedMicros = 0;
+        int64_t startedMicros = 0;
+        int64_t finishedMicros = 0;
+    };
+
+    struct DeviceStats
+    {
+        uint8_t address = 0;
+        uint32_t transfers = 0;
+        uint32_t failures = 0; // NO_ANSWER and BUS_ERROR
+        uint32_t expired = 0;
+        uint32_t worstMicros = 0;   // Longest from submitting to finishing
+        uint64_t latencyMicros = 0; // All of those
+        uint64_t busMicros = 0;     // Time spent on the bus
+
+        uint32_t meanMicros() const { return transfers ? (uint32_t)(latencyMicros / transfers) : 0; }
+    };
+
+private:
+    TwoWire *wire = nullptr;
+    DeviceStats devices[I2C_BUS_DEVICES];
+    uint8_t deviceCount = 0;
+    uint8_t inFlight = 0;
+
+    Status exchange(Transfer &transfer);
+    void run(Transfer &transfer);
+    void runBatch(Transfer *batch, int n);
+    void record(const Transfer &transfer);
+#ifdef ESP32
+    QueueHandle_t requests = nullptr;
+    QueueHandle_t results = nullptr;
+    SemaphoreHandle_t lock = nullptr;
+    static void worker(void *self);
+#else
+    Transfer queue[I2C_BUS_QUEUE_LENGTH]; // Run by poll() off the device
+    uint8_t queued = 0;
+#endif
+
+public:
+    // The port, started by the caller
+    void begin(TwoWire &port);
+
+    // Queues a copy; false when the queue is full
+    bool submit(const Transfer &transfer);
+
+    // Runs one now, waiting for the bus; true if it went through
+    bool transfer(Transfer &transfer);
+
+    // Finishes what has been run: stats, then callbacks
+    void poll();
+
+    uint8_t pending() const { return inFlight; }
+    uint8_t deviceTotal() const { return deviceCount; }
+    const DeviceStats &device(uint8_t i) const { return devices[i]; }
+};
+
+#endif // I2C_BUS_H
@@ -0,0 +1,731 @@
+// Microbenchmarks for the render kernels. Timings are host nanoseconds per
+// pixel: they rank the variants, they do not predict the ESP32-S3. The I2C,
+// settings and bus ones count bus time on the Wire stand-in, which is the
+// same on any host. The calendar one times the clock fields per loop pass.
+
+#include <chrono>
+#include <stdio.h>
+#include "Arduino.h"
+#include "CalendarTime.h"
+#include "DS1307.h"
+#include "Ds1307Chip.h"
+#include "HostBench.h"
+#include "I2cBus.h"
+#include "M5Dial.h"
+#include "Preferences.h"
+#include "SettingsStore.h"
+#include "SoftClock.h"
+#include "fonts/Noto.h"
+#include "fonts/NotoPacked.h"
+#include "fonts/bigFont.h"
+#include "fonts/bigFontPacked.h"
+#include "fonts/middleFont.h"
+#include "fonts/middleFontPacked.h"
+#include "fonts/secFont.h"
+#include "fonts/secFontPacked.h"
+#include "gfx/Canvas.h"
+#include "gfx/MemoryTarget.h"
+#include "gfx/BlendRamp.h"
+#include "gfx/Rgb565.h"
+#include "gfx/Spans565.h"
+#include "gfx/VlwFont.h"
+#include "Wire.h"
+
+namespace
+{
+    uint64_t nowNanos()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Keeps the compiler from dropping work whose result is otherwise unused
+    volatile uint32_t sink;
+
+    uint32_t checksum(const uint16_t *p, int n)
+    {
+        uint32_t sum = 0;
+        for (int i = 0; i < n; i++)
+            sum = sum * 31 + p[i];
+        return sum;
+    }
+
+    // Alpha of every pixel of the clock digits, as drawGlyph() sees them
+    int glyphAlphas(uint8_t *out, int capacity)
+    {
+        static VlwFont font;
+        if (!font.loaded())
+            font.load(bigFont);
+        int n = 0;
+        for (const char *c = "0123456789:"; *c; c++)
+        {
+            const VlwFont::Glyph *g = font.find((uint8_t)*c);
+            if (!g)
+                continue;
+            const uint8_t *alpha = font.bitmap(*g);
+            for (int i = 0; i < g->width * g->height && n < capacity; i++)
+                out[n++] = alpha[i];
+        }
+        return n;
+    }
+}
+
+bool host::benchBlend()
+{
+    // Equivalence first: every alpha of every colour over black, and over a
+    // spread of other backgrounds
+    static const uint16_t backgrounds[] = {0x0000, 0xFFFF, 0x8410, 0xA380, 0x001F, 0x07E0, 0xF800};
+    BlendRamp ramp;
+    uint32_t checked = 0;
+    for (uint16_t bg : backgrounds)
+        for (uint32_t fg = 0; fg <= 0xFFFF; fg += bg ? 7 : 1)
+        {
+            ramp.build(fg, bg);
+            for (int a = 0; a < 256; a++, checked++)
+                if (fromPanel565(ramp.at(a)) != blend565(a, fg, bg))
+                {
+                    printf("blend: ramp %04X over %04X at alpha %d gives %04X, blend565 %04X\n", (unsigned)fg, bg, a,
+                           fromPanel565(ramp.at(a)), blend565(a, fg, bg));
+                    return false;
+                }
+        }
+    printf("blend: ramps match blend565 for %u colour/alpha pairs\n", (unsigned)checked);
+
+    static uint8_t alphas[64 * 1024];
+    static uint16_t out[64 * 1024];
+    int n = glyphAlphas(alphas, sizeof(alphas));
+
+    // Only the pixels that blend, for the cost of a blend itself
+    static uint8_t edgeAlphas[64 * 1024];
+    int edges = 0;
+    for (int i = 0; i < n; i++)
+        if (alphas[i] && alphas[i] != 255)
+            edgeAlphas[edges++] = alphas[i];
+
+    struct Stream
+    {
+        const char *name;
+        const uint8_t *alpha;
+        int n;
+    } streams[] = {{"glyphs", alphas, n}, {"edges", edgeAlphas, edges}};
+
+    constexpr int rounds = 2000;
+    const uint16_t colors[] = {0xA380, 0xFFFF, 0xFDA0, 0x7BEF};
+    uint32_t generic = 0, ramped = 0; // Checksums, so the loops are not dropped
+    RampCache<8> cache;
+    printf("blend: clock digit bitmaps, %d pixels of which %d blend, %d rounds\n", n, edges, rounds);
+    printf("  %-8s %10s %10s\n", "ns/px", "blend565", "ramp");
+
+    for (const Stream &stream : streams)
+    {
+        // The loop drawGlyph() ran before: mix every edge pixel
+        uint64_t start = nowNanos();
+        for (int r = 0; r < rounds; r++)
+        {
+            uint16_t fg = colors[r & 3], bg = 0;
+            for (int i = 0; i < stream.n; i++)
+            {
+                uint8_t a = stream.alpha[i];
+                out[i] = a == 255 ? fg : a ? blend565(a, fg, bg) : 0;
+            }
+            generic += checksum(out, 16);
+        }
+        uint64_t genericNanos = nowNanos() - start;
+
+        // What it runs now: one cache lookup per string, one load per pixel
+        start = nowNanos();
+        for (int r = 0; r < rounds; r++)
+        {
+            const BlendRamp &lut = cache.get(colors[r & 3], 0);
+            for (int i = 0; i < stream.n; i++)
+            {
+                uint8_t a = stream.alpha[i];
+                out[i] = a == 255 ? lut.solid : a ? lut.at(a) : 0;
+            }
+            ramped += checksum(out, 16);
+        }
+        uint64_t rampNanos = nowNanos() - start;
+
+        double pixels = (double)stream.n * rounds;
+        printf("  %-8s %10.2f %10.2f  (%.2fx)\n", stream.name, genericNanos / pixels, rampNanos / pixels,
+               (double)genericNanos / rampNanos);
+    }
+
+    // Cost of a miss: building one ramp from scratch
+    constexpr int builds = 100000;
+    uint64_t start = nowNanos();
+    for (int i = 0; i < builds; i++)
+    {
+        ramp.build(0xA380 + i, i & 1 ? 0 : 0x8410);
+        sink = ramp.level[i % BlendRamp::levels];
+    }
+    uint64_t buildNanos = nowNanos() - start;
+    sink = generic ^ ramped;
+
+    printf("  ramp build %.1f ns; %u builds for %d strings\n", (double)buildNanos / builds, (unsigned)cache.builds(),
+           2 * rounds);
+    return true;
+}
+
+namespace
+{
+    // Nanoseconds per pixel of one kernel over spans of n pixels
+    template <class Kernel>
+    double timeSpan(Kernel kernel, int n, int rounds)
+    {
+        uint64_t start = nowNanos();
+        for (int r = 0; r < rounds; r++)
+            kernel(r);
+        return (double)(nowNanos() - start) / ((double)n * rounds);
+    }
+
+    template <class Impl>
+    void timeSpans(const char *name, uint16_t *dst, const uint16_t *src, const uint8_t *alpha, int n, int rounds, double out[4])
+    {
+        out[0] = timeSpan([&](int r) { Impl::fill(dst + (r & 1), (uint16_t)r, n); sink = dst[n / 2]; }, n, rounds);
+        out[1] = timeSpan([&](int r) { Impl::copy(dst, src + (r & 1), n); sink = dst[n / 2]; }, n, rounds);
+        out[2] = timeSpan([&](int r) { Impl::swapBytes(dst, src + (r & 1), n); sink = dst[n / 2]; }, n, rounds);
+        out[3] = timeSpan([&](int r) { Impl::blend(dst, alpha + (r & 1), (uint16_t)r, n); sink = dst[n / 2]; }, n, rounds);
+        printf("  %-8s %8.3f %8.3f %8.3f %8.3f\n", name, out[0], out[1], out[2], out[3]);
+    }
+}
+
+bool host::benchSpans()
+{
+    // Long enough for a full clear of the 240x240 framebuffer
+    constexpr int length = 240 * 240;
+    static uint16_t scratch[4 * (length + 16)] __attribute__((aligned(16)));
+
+    bool swar = spansMatch<SwarSpans>(scratch, 1024, 1) && spansMatch<SwarSpans>(scratch, 1024, 2);
+    bool selected = spansMatch<Spans>(scratch, 1024, 3);
+    printf("spans: SwarSpans %s, Spans %s the scalar reference\n", swar ? "matches" : "DIFFERS FROM",
+           selected ? "matches" : "DIFFERS FROM");
+    if (!swar || !selected)
+        return false;
+
+    uint16_t *dst = scratch, *src = scratch + length + 16;
+    uint8_t *alpha = (uint8_t *)(scratch + 2 * (length + 16));
+    uint32_t seed = 7;
+    for (int i = 0; i < length + 16; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        src[i] = seed >> 16;
+        alpha[i] = (seed >> 8) & 3 ? (seed >> 8 & 1 ? 255 : 0) : seed >> 24; // Mostly empty and solid, as glyphs are
+    }
+
+    // A dirty-rect row and a whole-frame clear; odd rounds start one pixel
+    // in, so both alignments are timed
+    static const int lengths[] = {64, 240, length};
+    for (int n : lengths)
+    {
+        int rounds = (int)(20000000 / n);
+        double scalar[4], fast[4];
+        printf("spans: %d px, ns per pixel\n  %-8s %8s %8s %8s %8s\n", n, "", "fill", "copy", "swap", "blend");
+        timeSpans<ScalarSpans>("scalar", dst, src, alpha, n, rounds, scalar);
+        timeSpans<Spans>("Spans", dst, src, alpha, n, rounds, fast);
+        printf("  %-8s %7.2fx %7.2fx %7.2fx %7.2fx\n", "speedup", scalar[0] / fast[0], scalar[1] / fast[1],
+               scalar[2] / fast[2], scalar[3] / fast[3]);
+    }
+    return true;
+}
+
+bool host::benchText()
+{
+    struct Face
+    {
+        const char *name;
+        const uint8_t *vlw, *packed;
+        size_t vlwBytes, packedBytes;
+        const char *text;
+    } faces[] = {
+        {"bigFont", bigFont, bigFontPacked, sizeof(bigFont), sizeof(bigFontPacked), "12:34"},
+        {"secFont", secFont, secFontPacked, sizeof(secFont), sizeof(secFontPacked), "56"},
+        {"middleFont", middleFont, middleFontPacked, sizeof(middleFont), sizeof(middleFontPacked), "Manual Time Set"},
+        {"Noto", Noto, NotoPacked, sizeof(Noto), sizeof(NotoPacked), "APLISENS"},
+    };
+
+    MemoryTarget target;
+    Canvas canvas(target);
+    if (!canvas.begin())
+        return false;
+    Surface &fb = canvas.surface();
+    static uint16_t before[240 * 240];
+    constexpr int rounds = 2000;
+
+    printf("text: drawString, raw 8-bit alpha against packed 4-bit runs\n");
+    printf("  %-11s %8s %8s %8s %8s %9s %9s %7s %6s\n", "font", "bytes", "packed", "reads", "packed", "raw us", "packed us",
+           "speedup", "diff");
+    for (const Face &face : faces)
+    {
+        VlwFont raw, packed;
+        raw.load(face.vlw);
+        packed.load(face.packed);
+
+        // Glyph bytes a string reads, which is what goes through the flash cache
+        uint32_t rawReads = 0, packedReads = 0;
+        for (const char *c = face.text; *c; c++)
+        {
+            const VlwFont::Glyph *g = raw.find((uint8_t)*c), *p = packed.find((uint8_t)*c);
+            if (!g || !p)
+                continue;
+            static uint8_t line[256];
+            GlyphRuns runs(packed.bitmap(*p));
+            for (int row = 0; row < p->height; row++)
+                runs.read(line, p->width);
+            rawReads += g->width * g->height;
+            packedReads += runs.position() - packed.bitmap(*p);
+        }
+        canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+        canvas.setTextDatum(Canvas::MC_DATUM);
+
+        double micros[2] = {1e9, 1e9};
+        const VlwFont *fonts[2] = {&raw, &packed};
+        canvas.fillScreen(TFT_BLACK);
+        canvas.drawString(face.text, 120, 120); // Builds the ramp outside the timing
+        // Best of, against scheduling noise; the two take turns, so a slow
+        // spell of the host does not land on one of them only
+        for (int repeat = 0; repeat < 25; repeat++)
+            for (int f = 0; f < 2; f++)
+            {
+                canvas.setFont(fonts[f]);
+                uint64_t start = nowNanos();
+                for (int r = 0; r < rounds; r++)
+                    canvas.drawString(face.text, 120 + (r & 1), 120);
+                double us = (nowNanos() - start) / 1000.0 / rounds;
+                micros[f] = us < micros[f] ? us : micros[f];
+            }
+
+        for (int f = 0; f < 2; f++)
+        {
+            canvas.setFont(fonts[f]);
+            canvas.fillScreen(TFT_BLACK);
+            canvas.drawString(face.text, 120, 120);
+            if (!f)
+                for (int y = 0; y < 240; y++)
+                    fb.readRow(y, 0, 240, before + y * 240);
+        }
+
+        // Largest channel difference between the raw rendering and the
+        // packed one still on the surface, out of 255
+        int diff = 0;
+        uint16_t row[240];
+        for (int y = 0; y < 240; y++)
+        {
+            fb.readRow(y, 0, 240, row);
+            for (int x = 0; x < 240; x++)
+            {
+                uint16_t a = fromPanel565(before[y * 240 + x]), b = fromPanel565(row[x]);
+                int d[3] = {((a >> 11) - (b >> 11)) * 255 / 31, (((a >> 5) & 63) - ((b >> 5) & 63)) * 255 / 63,
+                            ((a & 31) - (b & 31)) * 255 / 31};
+                for (int v : d)
+                    diff = abs(v) > diff ? abs(v) : diff;
+            }
+        }
+        printf("  %-11s %8u %8u %8u %8u %9.2f %9.2f %6.2fx %6d\n", face.name, (unsigned)face.vlwBytes,
+               (unsigned)face.packedBytes, (unsigned)rawReads, (unsigned)packedReads, micros[0], micros[1], micros[0] / micros[1],
+               diff);
+    }
+    return true;
+}
+
+namespace
+{
+    // DS1307 transfers as lib/DS1307 made them before: the register pointer
+    // write and the read as two transactions, and getRam() asking for one
+    // byte and reading 55
+    void oldGetTime(uint8_t *registers)
+    {
+        Wire.beginTransmission(DS1307_I2C_ADDRESS);
+        Wire.write((uint8_t)0x00);
+        Wire.endTransmission();
+        Wire.requestFrom(DS1307_I2C_ADDRESS, 7);
+        for (int i = 0; i < 7; i++)
+            registers[i] = Wire.read();
+    }
+
+    uint8_t oldReadRegister(uint8_t reg)
+    {
+        Wire.beginTransmission(DS1307_I2C_ADDRESS);
+        Wire.write(reg);
+        Wire.endTransmission();
+        Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
+        return Wire.read();
+    }
+
+    int oldGetRam(uint8_t *ram)
+    {
+        Wire.beginTransmission(DS1307_I2C_ADDRESS);
+        Wire.write(0x08);
+        Wire.endTransmission();
+        Wire.requestFrom(DS1307_I2C_ADDRESS, 1);
+        int answered = 0;
+        for (int i = 0; i < 55; i++)
+        {
+            int b = Wire.read();
+            answered += b >= 0;
+            ram[i] = b;
+        }
+        return answered;
+    }
+
+    void oldSetRam(const uint8_t *ram)
+    {
+        Wire.beginTransmission(DS1307_I2C_ADDRESS);
+        Wire.write(0x08);
+        for (int i = 0; i < 55; i++)
+            Wire.write(ram[i]);
+        Wire.endTransmission();
+    }
+
+    // RTClib 2.1 joins the pointer write and the read with a repeated start
+    // (Adafruit_I2CDevice::write_then_read), one register group at a time
+    void rtclibRead(uint8_t reg, uint8_t *data, uint8_t n)
+    {
+        Wire.beginTransmission(DS1307_I2C_ADDRESS);
+        Wire.write(reg);
+        Wire.endTransmission(false);
+        Wire.requestFrom(DS1307_I2C_ADDRESS, n);
+        for (int i = 0; i < n; i++)
+            data[i] = Wire.read();
+    }
+
+    template <class Op>
+    void busCost(const char *name, Op op)
+    {
+        TwoWire::Stats before = Wire.stats();
+        op();
+        const TwoWire::Stats &after = Wire.stats();
+        printf("  %-46s %3u %4u %7.0f\n", name, (unsigned)(after.transactions - before.transactions),
+               (unsigned)(after.bytes - before.bytes), Wire.busMicros(before));
+    }
+}
+
+namespace
+{
+    // RTClib 2.1's DateTime(uint32_t), which SoftClock::now() runs on the
+    // device: the years and then the months since 2000 counted off one at a
+    // time
+    void rtclibFromUnix(uint32_t t, uint8_t *fields)
+    {
+        static const uint8_t daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        t -= 946684800;
+        fields[5] = t % 60;
+        t /= 60;
+        fields[4] = t % 60;
+        t /= 60;
+        fields[3] = t % 24;
+        uint16_t days = t / 24;
+        uint8_t year, month, leap;
+        for (year = 0;; ++year)
+        {
+            leap = year % 4 == 0;
+            if (days < 365U + leap)
+                break;
+            days -= 365 + leap;
+        }
+        for (month = 1; month < 12; ++month)
+        {
+            uint8_t length = daysInMonth[month - 1] + (leap && month == 2);
+            if (days < length)
+                break;
+            days -= length;
+        }
+        fields[0] = year;
+        fields[1] = month;
+        fields[2] = days + 1;
+    }
+
+    // Whether the fields are those of unix second t
+    bool sameTime(const CalendarTime &c, uint32_t t)
+    {
+        DateTime d(t);
+        return c.unixtime() == t && c.year() == d.year() && c.month() == d.month() && c.day() == d.day() &&
+               c.hour() == d.hour() && c.minute() == d.minute() && c.second() == d.second() &&
+               c.dayOfTheWeek() == d.dayOfTheWeek();
+    }
+
+    // Hides v from the optimizer, so work on it is not hoisted out of a loop
+    uint32_t opaque(uint32_t v)
+    {
+        asm volatile("" : "+r"(v));
+        return v;
+    }
+
+    template <class Op>
+    double nanosPerCall(Op op)
+    {
+        constexpr int calls = 20000000;
+        uint64_t start = nowNanos();
+        for (int i = 0; i < calls; i++)
+            op(i);
+        return (double)(nowNanos() - start) / calls;
+    }
+}
+
+bool host::benchI2c()
+{
+    host::Ds1307Chip chip;
+    Wire.attach(chip);
+    chip.set(DateTime(2024, 5, 6, 7, 8, 9));
+    I2cBus i2c;
+    i2c.begin(Wire);
+    DS1307 rtc;
+    rtc.begin(i2c);
+    uint8_t registers[8], pattern[DS1307_RAM_SIZE], ram[DS1307_RAM_SIZE];
+    for (int i = 0; i < DS1307_RAM_SIZE; i++)
+        pattern[i] = (uint8_t)(i * 37 + 11);
+
+    printf("i2c: DS1307 transfers at 100 kHz\n");
+    printf("  %-46s %3s %4s %7s\n", "", "txns", "bytes", "bus us");
+    busCost("time + halt bit, lib/DS1307 before", [&] {
+        oldGetTime(registers);
+        oldReadRegister(0x00);
+    });
+    busCost("time + halt bit + SQW, RTClib 2.1", [&] {
+        rtclibRead(0x00, registers, 7); // now()
+        rtclibRead(0x00, registers, 1); // isrunning()
+        rtclibRead(0x07, registers, 1); // readSqwPinMode()
+    });
+    bool timeOk = false;
+    busCost("time + halt bit + SQW, burst getTime()", [&] {
+        timeOk = rtc.getTime() && rtc.year == 24 && rtc.month == 5 && rtc.dayOfMonth == 6 && rtc.hour == 7 &&
+                 rtc.minute == 8 && rtc.second == 9 && !rtc.halted;
+    });
+
+    memcpy(rtc.ram, pattern, sizeof(pattern));
+    busCost("RAM write, lib/DS1307 before (55 bytes)", [&] { oldSetRam(pattern); });
+    busCost("RAM write, setRam()", [&] { rtc.setRam(); });
+    int answered = 0;
+    busCost("RAM read, lib/DS1307 before (1 byte asked)", [&] { answered = oldGetRam(ram); });
+    memset(rtc.ram, 0, sizeof(rtc.ram));
+    bool ramOk = false;
+    busCost("RAM read, getRam()", [&] { ramOk = rtc.getRam() && !memcmp(rtc.ram, pattern, sizeof(pattern)); });
+    printf("  old getRam() got %d of 56 bytes; new one %s, burst time %s\n", answered, ramOk ? "matches" : "DIFFERS",
+           timeOk ? "matches" : "DIFFERS");
+
+    // The async path reaches the fields only in poll()
+    memset(rtc.ram, 0, sizeof(rtc.ram));
+    bool called = false;
+    rtc.getRamAsync([](DS1307 &, bool ok, void *flag) { *(bool *)flag = ok; }, &called);
+    bool deferred = !called && rtc.pending() == 1;
+    rtc.poll();
+    bool asyncOk = deferred && called && !rtc.pending() && !memcmp(rtc.ram, pattern, sizeof(pattern));
+    printf("  getRamAsync() %s\n", asyncOk ? "finished in poll()" : "DID NOT FINISH IN poll()");
+
+    // Setting the clock while the bus is stuck: the write fails, and is made again
+    SoftClock clock(rtc, -1);
+    clock.begin();
+    DateTime set(2024, 5, 6, 9, 30, 0);
+    Wire.stretch(50000);
+    clock.adjust(set);
+    bool failed = false;
+    for (int ms = 0; ms < 3000; ms++)
+    {
+        clock.update();
+        failed |= !clock.rtcWritten();
+        host::advance(1000);
+    }
+    uint32_t shown = clock.unixSeconds();
+    bool retryOk = failed && clock.rtcWritten() && rtc.getTime() &&
+                   SecondTicker::timeOf(rtc).unixtime() - shown + 1 <= 2 && shown - set.unixtime() == 3;
+    printf("  adjust() on a stuck bus %s\n", retryOk ? "wrote the time again" : "DID NOT REACH THE RTC");
+    return timeOk && ramOk && asyncOk && retryOk;
+}
+
+bool host::benchSettings()
+{
+    host::Ds1307Chip chip;
+    Wire.attach(chip);
+    I2cBus i2c;
+    i2c.begin(Wire);
+    DS1307 rtc;
+    rtc.begin(i2c);
+    Preferences nvs;
+    static const char *sources[] = {"defaults", "NVRAM", "NVS"};
+
+    printf("settings: record of %d bytes in DS1307 RAM, NVS as backup\n", SettingsStore::recordBytes);
+    printf("  %-46s %3s %4s %7s\n", "", "txns", "bytes", "bus us");
+
+    // First boot: nothing anywhere, so the defaults, written back
+    SettingsStore first(rtc, nvs);
+    SettingsStore::Source fresh = first.load();
+    rtc.poll();
+    bool freshOk = fresh == SettingsStore::DEFAULTS && first.current().brightness == Settings().brightness;
+
+    // A save is one write on the bus, queued until poll(); NVS waits
+    busCost("save()", [&] {
+        first.save(Settings{120});
+        rtc.poll();
+    });
+    bool saveOk = !rtc.pending() && !first.failures() && !nvs.writes();
+    for (int i = 0; i < 10; i++)
+    {
+        first.save(Settings{(uint8_t)(100 + i)});
+        rtc.poll();
+        host::advance(1000000);
+        first.update();
+    }
+    bool backupHeld = !nvs.writes();
+    host::advance(300000000);
+    first.update();
+    first.update();
+    bool backupOk = backupHeld && nvs.writes() == 1 && nvs.getUInt("brightness") == 109;
+    printf("  11 saves: %u NVS writes within 5 minutes, %u after\n", backupHeld ? 0u : 1u, (unsigned)nvs.writes());
+
+    // Next boot finds the record
+    SettingsStore second(rtc, nvs);
+    SettingsStore::Source reloaded;
+    busCost("load() from NVRAM", [&] { reloaded = second.load(); });
+    bool reloadOk = reloaded == SettingsStore::NVRAM && second.current().brightness == 109;
+
+    // A damaged record falls back on NVS and is rewritten
+    chip.memory()[3] ^= 0x10;
+    SettingsStore third(rtc, nvs);
+    SettingsStore::Source damaged = third.load();
+    rtc.poll();
+    SettingsStore fourth(rtc, nvs);
+    bool repairOk = damaged == SettingsStore::NVS && third.current().brightness == 109 &&
+                    fourth.load() == SettingsStore::NVRAM && fourth.current().brightness == 109;
+    printf("  fresh: %s; reload: %s; damaged record: %s, then %s\n", sources[fresh], sources[reloaded],
+           sources[damaged], sources[fourth.source()]);
+
+    // A save the bus has no room for goes to NVS on the next update()
+    I2cBus::Transfer filler;
+    filler.address = DS1307_I2C_ADDRESS;
+    filler.writeLength = 1;
+    while (i2c.submit(filler))
+        ;
+    uint32_t writesBefore = nvs.writes();
+    fourth.save(Settings{77});
+    fourth.update();
+    bool fullOk = fourth.failures() == 1 && nvs.writes() == writesBefore + 1 && nvs.getUInt("brightness") == 77;
+    rtc.poll();
+    printf("  save() with the I2C queue full: %s\n", fullOk ? "backed up to NVS at once" : "BACKUP DELAYED");
+
+    bool ok = freshOk && saveOk && backupOk && reloadOk && repairOk && fullOk;
+    if (!ok)
+        printf("  MISMATCH: fresh %d save %d backup %d reload %d repair %d full queue %d\n", freshOk, saveOk, backupOk,
+               reloadOk, repairOk, fullOk);
+    return ok;
+}
+
+bool host::benchCalendar()
+{
+    // Every midnight from 2000 to 2099 ticked over, against a full decode
+    uint32_t checked = 0, wrong = 0;
+    CalendarTime c;
+    for (uint32_t day = DateTime(2000, 1, 1).unixtime(); day < DateTime(2100, 1, 1).unixtime(); day += 86400)
+    {
+        c.set(DateTime(day - 2));
+        c.advanceTo(day - 1);
+        DateTime d(day);
+        uint8_t expected = CalendarTime::SECOND | CalendarTime::MINUTE | CalendarTime::HOUR | CalendarTime::DAY |
+                           (d.day() == 1 ? CalendarTime::MONTH : 0) | (d.day() == 1 && d.month() == 1 ? CalendarTime::YEAR : 0);
+        wrong += c.advanceTo(day) != expected || !sameTime(c, day);
+        checked++;
+    }
+
+    // And every second of three days around a leap day, then a jump
+    uint32_t from = DateTime(2024, 2, 28).unixtime();
+    c.set(DateTime(from));
+    for (uint32_t t = from + 1; t < from + 3 * 86400; t++, checked++)
+        wrong += !c.advanceTo(t) || !sameTime(c, t) || c.advanceTo(t) != 0;
+    wrong += c.advanceTo(from) != CalendarTime::ALL || !sameTime(c, from);
+    printf("calendar: %u ticks checked against DateTime, %u wrong\n", (unsigned)checked, (unsigned)wrong);
+
+    // What a loop pass pays for the time shown. Most passes are in the
+    // second already held; the tick row counts on through 231 days, days
+    // and months rolling over included.
+    uint32_t base = DateTime(2024, 5, 6, 7, 8, 9).unixtime();
+    uint8_t fields[6];
+    double rtclib = nanosPerCall([&](int i) {
+        rtclibFromUnix(opaque(base + i), fields);
+        sink = fields[5] + fields[2];
+    });
+    double full = nanosPerCall([&](int i) {
+        DateTime d(opaque(base + i));
+        sink = d.second() + d.day();
+    });
+    c.set(DateTime(base));
+    double same = nanosPerCall([&](int) { sink = c.advanceTo(opaque(base)) + c.second(); });
+    double tick = nanosPerCall([&](int i) { sink = c.advanceTo(opaque(base + i + 1)) + c.second(); });
+    printf("  ns per loop pass, host\n");
+    printf("  %-40s %7.1f\n", "RTClib 2.1 DateTime(unixtime)", rtclib);
+    printf("  %-40s %7.1f\n", "DateTime(unixtime), host stand-in", full);
+    printf("  %-40s %7.1f\n", "CalendarTime::advanceTo(), same second", same);
+    printf("  %-40s %7.1f\n", "CalendarTime::advanceTo(), next second", tick);
+    return !wrong;
+}
+
+bool host::benchBus()
+{
+    host::Ds1307Chip chip;
+    Wire.attach(chip);
+    Wire.pace(true); // Transactions take their bus time, so latencies are real
+    I2cBus i2c;
+    i2c.begin(Wire);
+    DS1307 rtc;
+    rtc.begin(i2c);
+    chip.set(DateTime(2024, 5, 6, 7, 8, 9));
+    printf("bus: I2cBus with a DS1307 at 0x68 and nothing at 0x50, paced at 100 kHz\n");
+
+    // One batch: the time read goes ahead of the RAM write queued before it
+    static char order[4];
+    static int finished;
+    finished = 0;
+    auto note = [](DS1307 &, bool, void *tag) { order[finished++] = *(const char *)tag; };
+    I2cBus::Transfer probe;
+    probe.address = 0x50;
+    probe.done = [](const I2cBus::Transfer &t, void *) { order[finished++] = t.status == I2cBus::NO_ANSWER ? 'p' : '?'; };
+    bool queuedOk = rtc.setRamAsync(0, 8, note, (void *)"r") && i2c.submit(probe) && rtc.getTimeAsync(note, (void *)"t");
+    i2c.poll();
+    bool orderOk = queuedOk && finished == 3 && !memcmp(order, "tpr", 3);
+    printf("  batch of RAM write, probe, time read ran as %.3s\n", order);
+
+    // A transfer that waited past its timeout never reaches the bus
+    I2cBus::Transfer late;
+    late.address = DS1307_I2C_ADDRESS;
+    late.readLength = 1;
+    late.timeoutMicros = 5000;
+    static I2cBus::Status lateStatus;
+    late.done = [](const I2cBus::Transfer &t, void *) { lateStatus = t.status; };
+    uint32_t before = Wire.stats().transactions;
+    i2c.submit(late);
+    host::advance(10000);
+    i2c.poll();
+    bool expiryOk = lateStatus == I2cBus::EXPIRED && Wire.stats().transactions == before;
+
+    // A clock held low fails at the bus timeout rather than hanging
+    Wire.stretch(1000000);
+    I2cBus::Transfer stuck;
+    stuck.address = DS1307_I2C_ADDRESS;
+    stuck.data[0] = 0x00; // Register pointer, then a repeated start
+    stuck.writeLength = 1;
+    stuck.readLength = 1;
+    bool stuckFailed = !i2c.transfer(stuck) && stuck.status == I2cBus::BUS_ERROR;
+    int64_t stuckMicros = stuck.finishedMicros - stuck.startedMicros;
+    bool stuckOk = stuckFailed && stuckMicros >= I2C_BUS_TIMEOUT_MS * 1000 && stuckMicros < 2 * I2C_BUS_TIMEOUT_MS * 1000;
+    printf("  expired transfer %s the bus; clock held 1 s, failed after %lld us\n",
+           expiryOk ? "kept off" : "REACHED", (long long)stuckMicros);
+
+    // The queue has room for I2C_BUS_QUEUE_LENGTH
+    int accepted = 0;
+    for (int i = 0; i <= I2C_BUS_QUEUE_LENGTH; i++)
+        accepted += i2c.submit(probe);
+    i2c.poll();
+    bool fullOk = accepted == I2C_BUS_QUEUE_LENGTH && !i2c.pending();
+
+    printf("  %-6s %9s %6s %7s %9s %9s %9s\n", "device", "transfers", "failed", "expired", "mean us", "worst us",
+           "bus us");
+    for (uint8_t i = 0; i < i2c.deviceTotal(); i++)
+    {
+        const I2cBus::DeviceStats &d = i2c.device(i);
+        printf("  0x%02X   %9u %6u %7u %9u %9u %9u\n", d.address, (unsigned)d.transfers, (unsigned)d.failures,
+               (unsigned)d.expired, (unsigned)d.meanMicros(), (unsigned)d.worstMicros, (unsigned)d.busMicros);
+    }
+    Wire.pace(false);
+
+    bool ok = orderOk && expiryOk && stuckOk && fullOk;
+    if (!ok)
+        printf("  MISMATCH: order %d expiry %d stuck %d full %d\n", orderOk, expiryOk, stuckOk, fullOk);
+    return ok;
+}
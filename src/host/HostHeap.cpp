@@ -0,0 +1,35 @@
+// Counts heap allocations by interposing on the C allocator; operator new
+// and std::string go through malloc, so they are counted too. The
+// __libc_* entry points are glibc's own, so this builds on Linux hosts.
+
+#include <stddef.h>
+#include "HostHeap.h"
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *p, size_t size);
+}
+
+static uint32_t allocations = 0;
+
+extern "C" void *malloc(size_t size)
+{
+    allocations++;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    allocations++;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *p, size_t size)
+{
+    allocations++;
+    return __libc_realloc(p, size);
+}
+
+uint32_t host::heapAllocations() { return allocations; }
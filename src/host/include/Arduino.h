@@ -0,0 +1,168 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Stand-in for the parts of the Arduino core the firmware uses, so the
+// rendering code builds and runs on a desktop in the native environment.
+
+#include <algorithm>
+#include <chrono>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define PROGMEM
+#define F(s) (s)
+#define IRAM_ATTR
+
+#define INPUT 0x01
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+
+using std::max;
+using std::min;
+
+namespace host
+{
+    // Time runs at the real rate, so frame timings are real measurements,
+    // and the harness can skip ahead over the idle time between frames
+    inline uint64_t &skippedMicros()
+    {
+        static uint64_t skipped = 0;
+        return skipped;
+    }
+
+    inline uint64_t elapsedMicros()
+    {
+        static const auto start = std::chrono::steady_clock::now();
+        auto real = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return (uint64_t)real.count() + skippedMicros();
+    }
+
+    inline void advance(uint64_t micros) { skippedMicros() += micros; }
+}
+
+inline unsigned long micros() { return (unsigned long)host::elapsedMicros(); }
+inline unsigned long millis() { return (unsigned long)(host::elapsedMicros() / 1000); }
+inline void delay(unsigned long ms) { host::advance(ms * 1000); }
+
+// GPIO interrupts: stand-ins for the chips raise() the pins they drive
+namespace host
+{
+    struct Interrupt
+    {
+        void (*handler)() = nullptr;
+        int mode = 0;
+    };
+
+    inline Interrupt *interrupts()
+    {
+        static Interrupt table[49]; // ESP32-S3 GPIO numbers
+        return table;
+    }
+
+    inline void raise(int pin, int edge)
+    {
+        Interrupt &i = interrupts()[pin];
+        if (i.handler && i.mode == edge)
+            i.handler();
+    }
+}
+
+inline void pinMode(int, int) {}
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int pin, void (*handler)(), int mode) { host::interrupts()[pin] = {handler, mode}; }
+inline void detachInterrupt(int pin) { host::interrupts()[pin] = {}; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Always on the heap, without a small-string buffer, so the harness's
+// allocation check catches any String on a frame path
+class String
+{
+private:
+    char *buf = nullptr;
+
+    void assign(const char *s, size_t n)
+    {
+        char *next = (char *)malloc(n + 1);
+        memcpy(next, s, n);
+        next[n] = 0;
+        free(buf);
+        buf = next;
+    }
+
+public:
+    String() { assign("", 0); }
+    String(const char *s) { assign(s, strlen(s)); }
+    String(const String &s) { assign(s.buf, strlen(s.buf)); }
+    String(char c) { assign(&c, 1); }
+    String(int n) : String(std::to_string(n).c_str()) {}
+    String(unsigned n) : String(std::to_string(n).c_str()) {}
+    String(long n) : String(std::to_string(n).c_str()) {}
+    String(unsigned long n) : String(std::to_string(n).c_str()) {}
+    ~String() { free(buf); }
+
+    String &operator=(const String &s)
+    {
+        if (this != &s)
+            assign(s.buf, strlen(s.buf));
+        return *this;
+    }
+
+    const char *c_str() const { return buf; }
+    unsigned length() const { return strlen(buf); }
+
+    String &operator+=(const String &s)
+    {
+        size_t a = strlen(buf), b = strlen(s.buf);
+        char *next = (char *)malloc(a + b + 1);
+        memcpy(next, buf, a);
+        memcpy(next + a, s.buf, b + 1);
+        free(buf);
+        buf = next;
+        return *this;
+    }
+    friend String operator+(String a, const String &b) { return a += b; }
+    friend String operator+(const char *a, const String &b) { return String(a) += b; }
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(const uint8_t *data, size_t size) = 0;
+
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t println(const char *s = "") { return print(s) + print("\n"); }
+
+    size_t printf(const char *format, ...)
+    {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        return n > 0 ? write((const uint8_t *)buf, min((size_t)n, sizeof(buf) - 1)) : 0;
+    }
+};
+
+// Serial goes to stdout
+class HostSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    size_t write(const uint8_t *data, size_t size) override { return fwrite(data, 1, size, stdout); }
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
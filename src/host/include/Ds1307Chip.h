@@ -0,0 +1,123 @@
+#ifndef HOST_DS1307_CHIP_H
+#define HOST_DS1307_CHIP_H
+
+// A DS1307 on the Wire stand-in: the clock and control registers and the
+// 56 bytes of RAM behind the register pointer. The clock counts on from the
+// last setting at the rate of micros(), so it follows the time the harness
+// skips ahead, or at an offset rate set by setDrift(). A START latches the
+// time for reading, and writing the seconds restarts the second, as on the
+// chip. With the 1 Hz square wave on, update() pulls the SQW pin low at
+// every second, if the harness wired it to one.
+
+#include "Arduino.h"
+#include "RTClib.h"
+#include "Wire.h"
+
+namespace host
+{
+    class Ds1307Chip : public I2cDevice
+    {
+    private:
+        uint32_t base = DateTime(2024, 1, 1, 12, 0, 0).unixtime();
+        uint64_t setAt = 0;
+        bool halted = false;
+        uint8_t control = 0;
+        uint8_t ram[56] = {};
+        uint8_t pointer = 0;
+        uint8_t latched[8] = {};
+        int32_t ppm = 0;
+        int sqwPin = -1;
+        uint32_t lastEdge = 0;
+
+        static uint8_t bcd(int v) { return (uint8_t)(v / 10 * 16 + v % 10); }
+        static int dec(uint8_t v) { return v / 16 * 10 + v % 16; }
+
+        uint32_t seconds() const
+        {
+            if (halted)
+                return base;
+            int64_t elapsed = (int64_t)(elapsedMicros() - setAt);
+            return base + (uint32_t)((elapsed + elapsed * ppm / 1000000) / 1000000);
+        }
+
+    public:
+        uint8_t address() const override { return 0x68; }
+
+        void start() override
+        {
+            DateTime t(seconds());
+            latched[0] = bcd(t.second()) | (halted ? 0x80 : 0);
+            latched[1] = bcd(t.minute());
+            latched[2] = bcd(t.hour());
+            latched[3] = bcd(t.dayOfTheWeek() ? t.dayOfTheWeek() : 7); // 1 is Monday
+            latched[4] = bcd(t.day());
+            latched[5] = bcd(t.month());
+            latched[6] = bcd(t.year() - 2000);
+            latched[7] = control;
+        }
+
+        void receive(const uint8_t *data, size_t n) override
+        {
+            if (!n)
+                return;
+            pointer = data[0] & 0x3F;
+            bool timeWritten = false;
+            for (size_t i = 1; i < n; i++)
+            {
+                if (pointer < 7)
+                {
+                    latched[pointer] = data[i];
+                    timeWritten = true;
+                }
+                else if (pointer == 7)
+                    control = data[i];
+                else
+                    ram[pointer - 8] = data[i];
+                pointer = (pointer + 1) & 0x3F;
+            }
+            if (timeWritten)
+            {
+                base = DateTime(2000 + dec(latched[6]), dec(latched[5]), dec(latched[4]), dec(latched[2] & 0x3F),
+                                dec(latched[1]), dec(latched[0] & 0x7F))
+                           .unixtime();
+                setAt = elapsedMicros();
+                halted = latched[0] & 0x80;
+                lastEdge = base;
+            }
+        }
+
+        void send(uint8_t *data, size_t n) override
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                data[i] = pointer < 8 ? latched[pointer] : ram[pointer - 8];
+                pointer = (pointer + 1) & 0x3F;
+            }
+        }
+
+        // Harness side: the time, which GPIO the SQW output is wired to, the
+        // wire itself, and how far the crystal is off
+        void set(const DateTime &time)
+        {
+            base = lastEdge = time.unixtime();
+            setAt = elapsedMicros();
+            halted = false;
+        }
+
+        void wireSqw(int pin) { sqwPin = pin; }
+        void setDrift(int32_t partsPerMillion) { ppm = partsPerMillion; }
+
+        // Harness side: the RAM, to damage or clear as a flat battery would
+        uint8_t *memory() { return ram; }
+
+        void update()
+        {
+            uint32_t s = seconds();
+            if (s != lastEdge && control == 0x10 && sqwPin >= 0)
+                raise(sqwPin, FALLING);
+            lastEdge = s;
+        }
+    };
+}
+
+#endif // HOST_DS1307_CHIP_H
@@ -0,0 +1,18 @@
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+namespace host
+{
+    // Microbenchmarks run by the harness's --bench option. Each checks its
+    // fast path against the reference before timing it and returns false
+    // if they disagree.
+    bool benchBlend();
+    bool benchSpans();
+    bool benchText();
+    bool benchI2c();
+    bool benchSettings();
+    bool benchCalendar();
+    bool benchBus();
+}
+
+#endif // HOST_BENCH_H
@@ -0,0 +1,12 @@
+#ifndef HOST_HEAP_H
+#define HOST_HEAP_H
+
+#include <stdint.h>
+
+namespace host
+{
+    // Every malloc, calloc, realloc and operator new made by the process
+    uint32_t heapAllocations();
+}
+
+#endif // HOST_HEAP_H
@@ -0,0 +1,160 @@
+#ifndef HOST_M5DIAL_H
+#define HOST_M5DIAL_H
+
+// Stand-in for the M5Dial board: a 240x240 panel that keeps what it was sent
+// in memory, the rotary encoder and the button. The harness drives the
+// encoder and button the way a hand would.
+
+#include "Arduino.h"
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_RED 0xF800
+#define TFT_ORANGE 0xFDA0
+#define TFT_DARKGREY 0x7BEF
+
+namespace lgfx
+{
+    struct rgb565_t
+    {
+        uint16_t raw;
+    };
+
+    // RGB565 high byte first, the order the panel takes off the wire
+    struct swap565_t
+    {
+        uint16_t raw;
+    };
+}
+
+// DMA is modelled by completing each transfer at the next fence: the pixels
+// are read from the caller's buffer only when waitDMA() runs, so a buffer
+// reused while its transfer is still in flight shows up as a corrupt frame.
+// rgb565_t pixels are byte swapped by the driver on their way out, as M5GFX
+// does, and counted; swap565_t pixels go out as they are.
+class M5GFX
+{
+public:
+    static constexpr int panelWidth = 240;
+    static constexpr int panelHeight = 240;
+
+private:
+    uint16_t glass[panelWidth * panelHeight] = {};
+    struct Transfer
+    {
+        int x, y, w, h;
+        const uint16_t *data;
+        bool swapped; // Already in wire order
+    } pending = {};
+    bool inFlight = false;
+    uint8_t level = 0;
+    int writeDepth = 0;
+
+    // The glass keeps plain RGB565, whichever order the pixels came in
+    void copy(const Transfer &t)
+    {
+        if (!t.swapped)
+            driverSwaps += (uint32_t)t.w * t.h;
+        for (int row = 0; row < t.h; row++)
+            for (int col = 0; col < t.w; col++)
+            {
+                int px = t.x + col, py = t.y + row;
+                uint16_t c = t.data[row * t.w + col];
+                if (px >= 0 && px < panelWidth && py >= 0 && py < panelHeight)
+                    glass[py * panelWidth + px] = t.swapped ? (uint16_t)(c << 8 | c >> 8) : c;
+            }
+    }
+
+    void push(const Transfer &t, bool dma)
+    {
+        waitDMA();
+        if (dma)
+        {
+            pending = t;
+            inFlight = true;
+            dmaTransfers++;
+        }
+        else
+        {
+            copy(t);
+            blockingPushes++;
+        }
+    }
+
+public:
+    uint32_t dmaTransfers = 0;
+    uint32_t blockingPushes = 0;
+    uint32_t driverSwaps = 0; // Pixels the driver had to byte swap
+
+    void startWrite() { writeDepth++; }
+    void endWrite()
+    {
+        waitDMA();
+        writeDepth--;
+    }
+
+    void setBrightness(uint8_t b) { level = b; }
+    uint8_t getBrightness() const { return level; }
+
+    void pushImage(int x, int y, int w, int h, const lgfx::rgb565_t *data) { push({x, y, w, h, &data->raw, false}, false); }
+    void pushImage(int x, int y, int w, int h, const lgfx::swap565_t *data) { push({x, y, w, h, &data->raw, true}, false); }
+    void pushImageDMA(int x, int y, int w, int h, const lgfx::rgb565_t *data) { push({x, y, w, h, &data->raw, false}, true); }
+    void pushImageDMA(int x, int y, int w, int h, const lgfx::swap565_t *data) { push({x, y, w, h, &data->raw, true}, true); }
+
+    void waitDMA()
+    {
+        if (!inFlight)
+            return;
+        copy(pending);
+        inFlight = false;
+    }
+
+    bool dmaBusy() const { return inFlight; }
+
+    // What the glass shows, once the last transfer has been fenced
+    const uint16_t *pixels() const { return glass; }
+};
+
+class HostEncoder
+{
+private:
+    long count = 0;
+
+public:
+    long read() const { return count; }
+    void write(long value) { count = value; }
+    void turn(int detents) { count += 4 * detents; } // Four counts per detent
+};
+
+// wasPressed() holds for one update(), as M5Unified's buttons do
+class HostButton
+{
+private:
+    bool queued = false;
+    bool pressed = false;
+
+public:
+    void press() { queued = true; }
+    bool wasPressed() const { return pressed; }
+
+    void update()
+    {
+        pressed = queued;
+        queued = false;
+    }
+};
+
+class M5DialClass
+{
+public:
+    M5GFX Display;
+    HostEncoder Encoder;
+    HostButton BtnA;
+
+    void begin() {}
+    void update() { BtnA.update(); }
+};
+
+extern M5DialClass M5Dial;
+
+#endif // HOST_M5DIAL_H
@@ -0,0 +1,39 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// Stand-in for the ESP32 NVS preferences, kept in memory for one run
+
+#include <map>
+#include <string>
+#include <stdint.h>
+
+class Preferences
+{
+private:
+    std::map<std::string, uint32_t> values;
+    uint32_t writeCount = 0;
+
+public:
+    bool begin(const char *, bool = false) { return true; }
+    void end() {}
+
+    bool isKey(const char *key) const { return values.count(key) != 0; }
+
+    uint32_t getUInt(const char *key, uint32_t defaultValue = 0) const
+    {
+        auto it = values.find(key);
+        return it == values.end() ? defaultValue : it->second;
+    }
+
+    size_t putUInt(const char *key, uint32_t value)
+    {
+        values[key] = value;
+        writeCount++;
+        return sizeof(value);
+    }
+
+    // Harness side: flash writes so far
+    uint32_t writes() const { return writeCount; }
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,58 @@
+#ifndef HOST_RTCLIB_H
+#define HOST_RTCLIB_H
+
+// Stand-in for RTClib's DateTime, which the firmware keeps for dates; the
+// DS1307 itself is lib/DS1307 on the bus, see Ds1307Chip.h.
+
+#include "Arduino.h"
+
+class DateTime
+{
+private:
+    uint16_t y = 2000;
+    uint8_t m = 1, d = 1, hh = 0, mm = 0, ss = 0;
+
+    // Days since 1970-01-01 of a proleptic Gregorian date
+    static int32_t daysFromCivil(int year, int month, int day)
+    {
+        year -= month <= 2;
+        int era = (year >= 0 ? year : year - 399) / 400;
+        int yoe = year - era * 400;
+        int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+public:
+    DateTime(uint32_t t = 946684800)
+    {
+        int32_t z = t / 86400 + 719468;
+        uint32_t secs = t % 86400;
+        int era = z / 146097;
+        int doe = z - era * 146097;
+        int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        int mp = (5 * doy + 2) / 153;
+        d = doy - (153 * mp + 2) / 5 + 1;
+        m = mp < 10 ? mp + 3 : mp - 9;
+        y = yoe + era * 400 + (m <= 2);
+        hh = secs / 3600;
+        mm = secs / 60 % 60;
+        ss = secs % 60;
+    }
+
+    DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0, uint8_t sec = 0)
+        : y(year), m(month), d(day), hh(hour), mm(min), ss(sec) {}
+
+    uint16_t year() const { return y; }
+    uint8_t month() const { return m; }
+    uint8_t day() const { return d; }
+    uint8_t hour() const { return hh; }
+    uint8_t minute() const { return mm; }
+    uint8_t second() const { return ss; }
+    uint8_t dayOfTheWeek() const { return (daysFromCivil(y, m, d) + 4) % 7; } // 0 is Sunday
+
+    uint32_t unixtime() const { return daysFromCivil(y, m, d) * 86400u + hh * 3600u + mm * 60u + ss; }
+};
+
+#endif // HOST_RTCLIB_H
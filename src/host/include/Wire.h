@@ -0,0 +1,178 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+// Stand-in for the Arduino Wire library: an I2C bus with the devices the
+// harness attaches. It counts what a logic analyser would see, START to
+// STOP, and times it at the bus clock: nine bits a byte, address included,
+// and one for each START and STOP. Paced, a transaction also takes that
+// long in simulated time, and the harness can have the clock held low at
+// the next START, which fails it after the timeout as on the ESP32.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Arduino.h"
+
+namespace host
+{
+    class I2cDevice
+    {
+    public:
+        virtual ~I2cDevice() {}
+        virtual uint8_t address() const = 0;
+        virtual void start() {}                                  // A START addressed to it, repeated or not
+        virtual void receive(const uint8_t *data, size_t n) = 0; // The master writes
+        virtual void send(uint8_t *data, size_t n) = 0;          // The master reads
+    };
+}
+
+class TwoWire
+{
+public:
+    struct Stats
+    {
+        uint32_t transactions = 0; // START ... STOP, repeated STARTs inside
+        uint32_t starts = 0;
+        uint32_t bytes = 0; // Address bytes included
+        uint64_t bits = 0;
+    };
+
+private:
+    static constexpr size_t bufferLength = 128; // As in the ESP32 core
+
+    host::I2cDevice *devices[4] = {};
+    int deviceCount = 0;
+    uint32_t frequency = 100000;
+    uint16_t timeoutMillis = 50; // As in the ESP32 core
+    bool paced = false;
+    uint32_t stretchMicros = 0; // Clock held low at the next START
+    bool open = false;          // Between a first START and its STOP
+    bool timedOut = false;      // Since that START
+    uint64_t openBits = 0;      // counts.bits at that START
+    uint8_t txAddress = 0;
+    uint8_t tx[bufferLength];
+    size_t txLength = 0;
+    uint8_t rx[bufferLength];
+    size_t rxLength = 0, rxNext = 0;
+    Stats counts;
+
+    host::I2cDevice *find(uint8_t address)
+    {
+        for (int i = 0; i < deviceCount; i++)
+            if (devices[i]->address() == address)
+                return devices[i];
+        return nullptr;
+    }
+
+    // START, address and the data bytes; an unanswered address ends there,
+    // as does a clock held low past the timeout
+    host::I2cDevice *transfer(uint8_t address, size_t bytes)
+    {
+        if (!open)
+        {
+            open = true;
+            timedOut = false;
+            openBits = counts.bits;
+        }
+        if (stretchMicros)
+        {
+            uint32_t limit = timeoutMillis * 1000u;
+            timedOut = stretchMicros > limit;
+            if (paced)
+                host::advance(timedOut ? limit : stretchMicros);
+            stretchMicros = 0;
+            if (timedOut)
+                return nullptr;
+        }
+        host::I2cDevice *device = find(address);
+        counts.starts++;
+        counts.bytes += device ? 1 + bytes : 1;
+        counts.bits += 1 + 9 * (device ? 1 + bytes : 1);
+        if (device)
+            device->start();
+        return device;
+    }
+
+    void stop()
+    {
+        counts.transactions++;
+        counts.bits++;
+        open = false;
+        if (paced)
+            host::advance((counts.bits - openBits) * 1000000 / frequency);
+    }
+
+public:
+    bool begin(int = -1, int = -1, uint32_t clock = 0)
+    {
+        if (clock)
+            frequency = clock;
+        return true;
+    }
+
+    void setClock(uint32_t clock) { frequency = clock; }
+    void setTimeOut(uint16_t millis) { timeoutMillis = millis; }
+    uint16_t getTimeOut() const { return timeoutMillis; }
+
+    void beginTransmission(uint8_t address)
+    {
+        txAddress = address;
+        txLength = 0;
+    }
+
+    size_t write(uint8_t data)
+    {
+        if (txLength == bufferLength)
+            return 0;
+        tx[txLength++] = data;
+        return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t n)
+    {
+        size_t i = 0;
+        while (i < n && write(data[i]))
+            i++;
+        return i;
+    }
+
+    // 0 when the device acknowledged, 2 when nothing answered the address,
+    // 5 on a timeout
+    uint8_t endTransmission(bool sendStop = true)
+    {
+        host::I2cDevice *device = transfer(txAddress, txLength);
+        if (device)
+            device->receive(tx, txLength);
+        if (sendStop || !device)
+            stop();
+        return device ? 0 : timedOut ? 5 : 2;
+    }
+
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true)
+    {
+        size_t n = quantity < bufferLength ? quantity : bufferLength;
+        host::I2cDevice *device = transfer(address, n);
+        rxLength = rxNext = 0;
+        if (device)
+        {
+            device->send(rx, n);
+            rxLength = n;
+        }
+        if (sendStop || !device)
+            stop();
+        return (uint8_t)rxLength;
+    }
+
+    int available() const { return (int)(rxLength - rxNext); }
+    int read() { return rxNext < rxLength ? rx[rxNext++] : -1; }
+
+    // Harness side
+    void attach(host::I2cDevice &device) { devices[deviceCount++] = &device; }
+    void pace(bool on) { paced = on; }
+    void stretch(uint32_t micros) { stretchMicros = micros; }
+    const Stats &stats() const { return counts; }
+    double busMicros(const Stats &since) const { return (counts.bits - since.bits) * 1e6 / frequency; }
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,10 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Stand-in for the ESP-IDF high resolution timer: simulated time
+inline int64_t esp_timer_get_time() { return (int64_t)host::elapsedMicros(); }
+
+#endif // HOST_ESP_TIMER_H
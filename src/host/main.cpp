@@ -0,0 +1,267 @@
+// Host harness for the native environment: runs Display against stand-ins
+// for the board, renders real frames and writes the last one as a PPM. It
+// exits with status 1 if any frame after begin() allocated from the heap,
+// or if no frame reached the target, panel or memory, to check.
+// --bench runs a kernel or bus microbenchmark instead of the clock.
+//
+//   clock_host [--seconds N] [--sweep] [--sqw] [--rtc-ppm N] [--time HH:MM:SS]
+//              [--screen clock|menu|brightness|time] [--target panel|memory]
+//              [--ppm FILE]
+//
+// --sqw wires the RTC's square wave output to a GPIO interrupt; --rtc-ppm
+// runs the RTC's crystal fast (or slow, when negative) against the CPU's.
+//   clock_host --bench blend|spans|text|i2c|settings|calendar|bus
+
+#include "Arduino.h"
+#include "M5Dial.h"
+#include "Display.h"
+#include "HostBench.h"
+#include "HostHeap.h"
+#include "gfx/MemoryTarget.h"
+#include "gfx/PanelTarget.h"
+#include "Preferences.h"
+#include "DS1307.h"
+#include "Ds1307Chip.h"
+#include "I2cBus.h"
+#include "RTClib.h"
+#include "Wire.h"
+
+M5DialClass M5Dial;
+HostSerial Serial;
+TwoWire Wire;
+
+static bool writePpm(const char *path, const uint16_t *pixels, int w, int h)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    for (int i = 0; i < w * h; i++)
+    {
+        uint16_t c = pixels[i];
+        uint8_t rgb[3] = {(uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 63) * 255 / 63), (uint8_t)((c & 31) * 255 / 31)};
+        fwrite(rgb, 1, 3, f);
+    }
+    return fclose(f) == 0;
+}
+
+static uint32_t framesChecked = 0;
+static uint32_t allocatingFrames = 0;
+static const MemoryTarget *memoryTarget = nullptr; // When frames go there instead of the panel
+static host::Ds1307Chip clockChip; // On Wire, driven along with simulated time
+static constexpr int sqwPin = 1;
+
+// Changes whenever a frame reaches the target, panel or memory
+static uint32_t framesOut()
+{
+    if (memoryTarget)
+        return memoryTarget->presentedPixels();
+    return M5Dial.Display.dmaTransfers + M5Dial.Display.blockingPushes;
+}
+
+// One pass of the firmware's loop(), then the simulated millisecond. A pass
+// that sent anything to the target drew a frame, and frames must not allocate.
+static void step(Display &display)
+{
+    M5Dial.update();
+    clockChip.update();
+    uint32_t out = framesOut();
+    uint32_t heap = host::heapAllocations();
+    display.loop();
+    if (framesOut() != out)
+    {
+        framesChecked++;
+        if (host::heapAllocations() != heap)
+            allocatingFrames++;
+    }
+    host::advance(1000);
+}
+
+static void run(Display &display, uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++)
+        step(display);
+}
+
+static void press(Display &display)
+{
+    M5Dial.BtnA.press();
+    run(display, 50);
+}
+
+static void turn(Display &display, int detents)
+{
+    M5Dial.Encoder.turn(detents);
+    run(display, 50);
+}
+
+static int usage()
+{
+    fprintf(stderr, "usage: clock_host [--seconds N] [--sweep] [--sqw] [--rtc-ppm N] "
+                    "[--time HH:MM:SS] "
+                    "[--screen clock|menu|brightness|time] [--target panel|memory] [--ppm FILE]\n"
+                    "       clock_host --bench blend|spans|text|i2c|settings|calendar|bus\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = 10;
+    bool sweep = false;
+    bool sqw = false;
+    int rtcPpm = 0;
+    int hh = 12, mm = 0, ss = 0;
+    const char *screen = "clock";
+    const char *targetName = "panel";
+    const char *ppm = "frame.ppm";
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool more = i + 1 < argc;
+        if (!strcmp(argv[i], "--seconds") && more)
+            seconds = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--sweep"))
+            sweep = true;
+        else if (!strcmp(argv[i], "--sqw"))
+            sqw = true;
+        else if (!strcmp(argv[i], "--rtc-ppm") && more)
+            rtcPpm = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--time") && more)
+        {
+            if (sscanf(argv[++i], "%d:%d:%d", &hh, &mm, &ss) != 3)
+                return usage();
+        }
+        else if (!strcmp(argv[i], "--screen") && more)
+            screen = argv[++i];
+        else if (!strcmp(argv[i], "--target") && more)
+            targetName = argv[++i];
+        else if (!strcmp(argv[i], "--ppm") && more)
+            ppm = argv[++i];
+        else if (!strcmp(argv[i], "--bench") && more)
+        {
+            const char *bench = argv[++i];
+            if (!strcmp(bench, "blend"))
+                return host::benchBlend() ? 0 : 1;
+            if (!strcmp(bench, "spans"))
+                return host::benchSpans() ? 0 : 1;
+            if (!strcmp(bench, "text"))
+                return host::benchText() ? 0 : 1;
+            if (!strcmp(bench, "i2c"))
+                return host::benchI2c() ? 0 : 1;
+            if (!strcmp(bench, "settings"))
+                return host::benchSettings() ? 0 : 1;
+            if (!strcmp(bench, "calendar"))
+                return host::benchCalendar() ? 0 : 1;
+            if (!strcmp(bench, "bus"))
+                return host::benchBus() ? 0 : 1;
+            return usage();
+        }
+        else
+            return usage();
+    }
+
+    PanelTarget panel;
+    MemoryTarget memory;
+    bool onPanel = strcmp(targetName, "memory") != 0;
+    RenderTarget &target = onPanel ? (RenderTarget &)panel : (RenderTarget &)memory;
+    memoryTarget = onPanel ? nullptr : &memory;
+
+    Wire.attach(clockChip);
+    I2cBus i2c;
+    i2c.begin(Wire);
+    DS1307 rtc;
+    rtc.begin(i2c);
+    Preferences preferences;
+    preferences.begin("dial_config", false);
+    clockChip.set(DateTime(2024, 1, 1, hh, mm, ss));
+    if (sqw)
+        clockChip.wireSqw(sqwPin);
+    clockChip.setDrift(rtcPpm);
+
+    Display display(target, rtc, preferences, sqw ? sqwPin : -1);
+    display.begin();
+    display.setSmoothSweep(sweep);
+    uint32_t reads = display.clock().rtcReads();
+    TwoWire::Stats bus = Wire.stats();
+    run(display, seconds * 1000);
+    reads = display.clock().rtcReads() - reads;
+    uint32_t transactions = Wire.stats().transactions - bus.transactions;
+    double perMinute = seconds ? 60.0 / seconds : 0.0;
+
+    const FrameHistogram &times = display.frameHistogram();
+    const auto &stats = display.frameStats();
+    printf("clock: %u frames in %d s at %d fps\n", (unsigned)times.samples(), seconds, display.sweepFps());
+    printf("  frame time p50 %u us, p99 %u us, %.1f%% within 16.7 ms\n", (unsigned)times.percentileMicros(50),
+           (unsigned)times.percentileMicros(99), times.withinBudget(16667));
+    printf("  latest frame: %u us, %u px pushed, %u us text\n", (unsigned)stats.frameMicros, (unsigned)stats.pushedPixels,
+           (unsigned)stats.textMicros);
+    printf("  framebuffer %u bytes\n", (unsigned)target.surface().bytes());
+    printf("  tick cache %u hits, %u misses; %u font allocations since begin\n", (unsigned)stats.tickCacheHits,
+           (unsigned)stats.tickCacheMisses, (unsigned)stats.fontAllocations);
+    printf("  %u blend ramps built\n", (unsigned)stats.rampBuilds);
+#if SWAP_STATS
+    printf("  %u px byte swapped on the CPU by the latest frame\n", (unsigned)stats.byteSwaps);
+#endif
+    printf("rtc: %u reads, %u I2C transactions, %.0f per minute%s\n", (unsigned)reads, (unsigned)transactions,
+           transactions * perMinute, sqw ? " (SQW interrupt)" : " (polled)");
+    printf("  %.0f us of bus time per minute at 100 kHz, on the bus task rather than in loop()\n",
+           Wire.busMicros(bus) * perMinute);
+    for (uint8_t i = 0; i < i2c.deviceTotal(); i++)
+    {
+        const I2cBus::DeviceStats &d = i2c.device(i);
+        printf("  0x%02X: %u transfers, %u failed, %u expired; submit to done mean %u us, worst %u us\n", d.address,
+               (unsigned)d.transfers, (unsigned)d.failures, (unsigned)d.expired, (unsigned)d.meanMicros(),
+               (unsigned)d.worstMicros);
+    }
+    const SoftClock::Drift &drift = display.clock().driftStats();
+    printf("  %u syncs, %u steps; drift at the latest %+d us, worst %d us, edge timed to %d us; RTC rate %+.1f ppm\n",
+           (unsigned)drift.syncs, (unsigned)drift.steps, (int)drift.lastMicros, (int)drift.worstMicros,
+           (int)drift.toleranceMicros, drift.ratePpb / 1000.0);
+
+    if (strcmp(screen, "clock") != 0)
+    {
+        press(display); // Settings menu
+        if (!strcmp(screen, "brightness"))
+            press(display);
+        else if (!strcmp(screen, "time"))
+        {
+            turn(display, 1);
+            press(display);
+        }
+        else if (strcmp(screen, "menu") != 0)
+            return usage();
+    }
+
+    const uint16_t *shown;
+    if (onPanel)
+    {
+        M5Dial.Display.waitDMA();
+        shown = M5Dial.Display.pixels();
+        const DmaPusher::Stats &dma = panel.pushStats();
+        printf("panel: %u DMA transfers, %llu px, %llu us waiting on the fence\n", (unsigned)dma.transfers,
+               (unsigned long long)dma.pixels, (unsigned long long)dma.waitMicros);
+        printf("  %u px byte swapped by the driver, %.1f per frame\n", (unsigned)M5Dial.Display.driverSwaps,
+               framesChecked ? (double)M5Dial.Display.driverSwaps / framesChecked : 0.0);
+    }
+    else
+        shown = memory.glassPixels();
+
+#if FRAME_PROFILER
+    display.dumpProfile(Serial);
+#endif
+
+    if (!writePpm(ppm, shown, 240, 240))
+    {
+        fprintf(stderr, "cannot write %s\n", ppm);
+        return 1;
+    }
+    printf("%s screen written to %s\n", screen, ppm);
+
+    printf("heap: %u of %u frames allocated\n", (unsigned)allocatingFrames, (unsigned)framesChecked);
+    if (!framesChecked)
+    {
+        fprintf(stderr, "no frames reached the %s target\n", targetName);
+        return 1;
+    }
+    return allocatingFrames ? 1 : 0;
+}
@@ -1,15 +1,17 @@
 #include "Arduino.h"
 #include "M5Dial.h"
 #include "Display.h"
+#include "gfx/PanelTarget.h"
+#include "gfx/Spans565.h"
+#include "DS1307.h"
+#include "I2cBus.h"
 #include "RTClib.h"
 #include "Wire.h"
 #include <Preferences.h>
 
-M5Canvas img(&M5Dial.Display);
-TFT_eSPI tft;
-TFT_eSprite sprite(&tft);
-RTC_DS1307 rtc; // define a object of DS1307 class
-// Display display(img, tft, sprite, rtc);
+PanelTarget panel;
+I2cBus i2c; // Port A, run by a task of its own
+DS1307 rtc; // define a object of DS1307 class
 Display *display;
 Preferences preferences;
 
@@ -19,17 +21,32 @@ void setup()
    cfg.internal_rtc = false; // Disable internal RTC
 
    M5Dial.begin(cfg, true, false);
+#if FRAME_PROFILER
+   Serial.begin(115200);
+#endif
    M5Dial.update();
    preferences.begin("dial_config", false); // Initialize preferences
-   M5Dial.Display.setBrightness(preferences.getUInt("brightness", 65)); // Set brightness from preferences
    Wire.begin(SDA, SCL); // Initialize I2C with custom pins
-   rtc.begin(&Wire);     // Pass the Wire instance to the RTC object
-   if (!rtc.isrunning())
+   i2c.begin(Wire);      // Every device on the port goes through i2c from here on
+   rtc.begin(i2c);
+   if (!rtc.isStarted())
    {
-      rtc.adjust(DateTime(F(__DATE__),F(__TIME__))); // Set the RTC to a known date and time
+      SoftClock::write(rtc, DateTime(F(__DATE__),F(__TIME__))); // Set the RTC to a known date and time
    }
 
-   display = new Display(img, sprite, tft, rtc, preferences);
+#if PIE_SPANS && defined(CONFIG_IDF_TARGET_ESP32S3)
+   // The vector kernels are only trusted once they match the scalar reference;
+   // otherwise fills and copies go back to SwarSpans
+   static uint16_t spanScratch[4 * (240 + 16)] __attribute__((aligned(16)));
+   if (!spansMatch<PieSpans>(spanScratch, 240))
+   {
+      PieSpans::vectors = false;
+      Serial.begin(115200);
+      Serial.println("PIE span kernels disagree with the reference; using SwarSpans");
+   }
+#endif
+
+   display = new Display(panel, rtc, preferences);
    display->begin();
 }
 
@@ -37,4 +54,13 @@ void loop()
 {
    M5Dial.update();
    display->loop();
+
+#if FRAME_PROFILER
+   static unsigned long lastDump = 0;
+   if (millis() - lastDump >= 10000)
+   {
+      display->dumpProfile(Serial); // USB-CDC, see ARDUINO_USB_CDC_ON_BOOT
+      lastDump = millis();
+   }
+#endif
 }
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""Packs a .vlw font header from include/fonts into the packed format that
+VlwFont also reads, and writes it as another header.
+
+    tools/packfont.py [--subset-from FILE]... [--keep CHARS] SOURCE TARGET
+
+With --subset-from, only the glyphs of characters in the string literals
+FILE draws with this font (and in --keep, for text made at run time) are
+packed; other glyphs are never drawn. tools/subset_fonts.py runs this for
+the UI's fonts.
+
+Layout, little-endian:
+
+    "PVLW"                                   magic
+    u16 glyphs, u16 ascent, u16 descent, u16 space width
+    glyphs x 12 byte records, the layout of VlwFont::Glyph:
+        u16 code, u8 width, u8 height, u8 xAdvance, i8 dX, i16 dY,
+        u32 offset of the glyph's pixel stream from the start of the file
+    pixel streams
+
+Alpha is cut to 4 bits and the pixels of a glyph, row after row, are
+coded as runs, one token byte each:
+
+    0x00-0x3F  1-64 transparent pixels
+    0x40-0x7F  1-64 solid pixels
+    0x80-0xBF  1-64 literal pixels, followed by their alphas two to a
+               byte, the first in the low nibble
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+RUN_MIN = 3  # Shorter runs of 0 or 15 stay inside literals
+MAX_RUN = 64
+
+
+def read_vlw(path):
+    text = re.sub(r"//[^\n]*|/\*.*?\*/", "", open(path).read(), flags=re.S)
+    match = re.search(r"const\s+uint8_t\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if not match:
+        sys.exit(f"{path}: no PROGMEM byte array")
+    return match.group(1), bytes(int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{1,2}", match.group(2)))
+
+
+def parse_vlw(vlw):
+    count, _, _, _, ascent, descent = struct.unpack(">6i", vlw[:24])
+    glyphs = []
+    data = 24 + 28 * count
+    for i in range(count):
+        code, height, width, advance, dy, dx, _ = struct.unpack(">7i", vlw[24 + 28 * i:52 + 28 * i])
+        glyphs.append(dict(code=code, width=width, height=height, advance=advance, dx=dx, dy=dy,
+                           alpha=vlw[data:data + width * height]))
+        data += width * height
+
+    # The same metrics VlwFont::load() derives
+    shown = [g for g in glyphs if not 0xA0 <= g["code"] <= 0xFF]
+    max_ascent = max([0] + [g["dy"] for g in shown])
+    max_descent = max([0] + [g["height"] - g["dy"] for g in shown])
+    return glyphs, max_ascent, max_descent, (ascent + descent) * 2 // 7
+
+
+LITERAL = r'"((?:[^"\\]|\\.)*)"'
+
+
+def literal_text(literal):
+    return literal.encode().decode("unicode_escape")
+
+
+def used_characters(paths, font):
+    """Characters of the string literals the given sources draw with font.
+
+    A literal belongs to the font named last before it, as <font>Packed in
+    setFont(), selectFont() and the like; an array of literals belongs to
+    the font named last before the array is used. #include lines,
+    fonts.add() and Preferences keys are never drawn."""
+    chars = set()
+    for path in paths:
+        text = re.sub(r"/\*.*?\*/", lambda m: "\n" * m.group(0).count("\n"), open(path).read(), flags=re.S)
+        text = re.sub(r"//[^\n]*", "", text)
+        text = re.sub(r"^\s*#include[^\n]*", "", text, flags=re.M)
+        text = re.sub(r"fonts\.add\([^)]*\)", "", text)
+        text = re.sub(r"preferences\.\w+\(\s*" + LITERAL, "", text)
+
+        arrays = {}
+
+        def array(match):
+            arrays[match.group(1)] = "".join(literal_text(l) for l in re.findall(LITERAL, match.group(2)))
+            return "\n" * match.group(0).count("\n")
+
+        text = re.sub(r'(\w+)\s*\[[^\]]*\]\s*=\s*\{((?:\s*"(?:[^"\\]|\\.)*"\s*,?)*)\}', array, text)
+
+        current = None
+        names = "|".join(map(re.escape, arrays)) or "(?!)"
+        for match in re.finditer(r"\b(\w+)Packed\b|" + LITERAL + r"|\b(" + names + r")\b", text):
+            if match.group(1):
+                current = match.group(1)
+                continue
+            drawn = literal_text(match.group(2)) if match.group(3) is None else arrays[match.group(3)]
+            if current is None and drawn:
+                line = text.count("\n", 0, match.start()) + 1
+                sys.exit(f"{path}:{line}: text drawn before any font is chosen")
+            if current == font:
+                chars.update(drawn)
+    return chars
+
+
+def quantize(alpha):
+    return (alpha * 15 + 127) // 255
+
+
+def encode(alpha):
+    levels = [quantize(a) for a in alpha]
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(0x80 | (len(chunk) - 1))
+            padded = chunk + [0] * (len(chunk) & 1)
+            out.extend(padded[i] | padded[i + 1] << 4 for i in range(0, len(padded), 2))
+
+    i = 0
+    while i < len(levels):
+        v = levels[i]
+        end = i
+        while end < len(levels) and levels[end] == v:
+            end += 1
+        if v in (0, 15) and end - i >= RUN_MIN:
+            flush()
+            for start in range(i, end, MAX_RUN):
+                n = min(MAX_RUN, end - start)
+                out.append((0x00 if v == 0 else 0x40) | (n - 1))
+        else:
+            literal.extend(levels[i:end])
+        i = end
+    flush()
+    return bytes(out)
+
+
+def pack(vlw, keep=None):
+    glyphs, ascent, descent, space = parse_vlw(vlw)
+    if keep is not None:
+        glyphs = [g for g in glyphs if chr(g["code"]) in keep]
+    streams = [encode(g["alpha"]) for g in glyphs]
+    header = b"PVLW" + struct.pack("<4H", len(glyphs), ascent, descent, space)
+    offset = len(header) + 12 * len(glyphs)
+    table = bytearray()
+    for g, s in zip(glyphs, streams):
+        table += struct.pack("<HBBBbhI", g["code"], g["width"], g["height"], g["advance"], g["dx"], g["dy"], offset)
+        offset += len(s)
+    return header + table + b"".join(streams)
+
+
+def write_header(path, name, packed, source, subset):
+    lines = [f"// Packed by tools/packfont.py from {source}{subset}; do not edit",
+             f"alignas(4) const uint8_t {name}[] PROGMEM = {{"]
+    for i in range(0, len(packed), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in packed[i:i + 16]) + ",")
+    lines.append("};")
+    open(path, "w").write("\n".join(lines) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack a .vlw font header.")
+    parser.add_argument("--subset-from", action="append", default=[], metavar="FILE")
+    parser.add_argument("--keep", default="", metavar="CHARS")
+    parser.add_argument("source")
+    parser.add_argument("target")
+    args = parser.parse_args()
+
+    name, vlw = read_vlw(args.source)
+    keep = used_characters(args.subset_from, name) | set(args.keep) if args.subset_from else None
+    packed = pack(vlw, keep)
+    sources = ", ".join(os.path.basename(f) for f in args.subset_from)
+    subset = f", only the glyphs {sources} draws with it" if args.subset_from else ""
+    write_header(args.target, name + "Packed", packed, args.source.split("/")[-1], subset)
+
+    glyphs = parse_vlw(vlw)[0]
+    kept = len(glyphs) if keep is None else sum(chr(g["code"]) in keep for g in glyphs)
+    print(f"{name}: {len(vlw)} bytes of vlw, {len(pack(vlw))} packed, {len(packed)} packed with "
+          f"{kept} of {len(glyphs)} glyphs")
+
+
+if __name__ == "__main__":
+    main()
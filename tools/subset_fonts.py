@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Packs the fonts the UI draws with, keeping only the glyphs it can show.
+
+    tools/subset_fonts.py [--check]
+
+Rewrites include/fonts/<font>Packed.h from its source font, keeping the
+glyphs Display.h draws with that font and those of the text composed for
+it at run time. The packed headers are committed and the build does not
+run this; run it after changing the UI's text or fonts. --check packs into
+a temporary directory instead and fails if a committed header differs, for
+CI.
+"""
+
+import filecmp
+import os
+import subprocess
+import sys
+import tempfile
+
+UI_SOURCES = ["include/Display.h"]
+# Each font, with the text TimeText composes in it at run time
+FONTS = {
+    "bigFont": "0123456789:",  # Hours and minutes
+    "secFont": "0123456789",   # Seconds
+    "middleFont": "0123456789%",  # Brightness and the time picker
+    "Noto": "0123456789",      # Dial labels
+}
+
+
+def subset(root, out):
+    tool = os.path.join(root, "tools", "packfont.py")
+    sources = [os.path.join(root, s) for s in UI_SOURCES]
+    for font, runtime in FONTS.items():
+        source = os.path.join(root, "include", "fonts", font + ".h")
+        command = [sys.executable, tool, "--keep", runtime]
+        for s in sources:
+            command += ["--subset-from", s]
+        subprocess.check_call(command + [source, os.path.join(out, font + "Packed.h")])
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    fonts = os.path.join(root, "include", "fonts")
+    if sys.argv[1:] != ["--check"]:
+        subset(root, fonts)
+        return 0
+    with tempfile.TemporaryDirectory() as out:
+        subset(root, out)
+        stale = [f for f in FONTS if not filecmp.cmp(os.path.join(out, f + "Packed.h"),
+                                                     os.path.join(fonts, f + "Packed.h"), shallow=False)]
+    for f in stale:
+        print(f"include/fonts/{f}Packed.h is out of date; run tools/subset_fonts.py")
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())